@@ -0,0 +1,88 @@
+// Copyright 2024 Guillaume Stordeur <guillaume.stordeur@gmail.com>
+// Copyright 2024 Matt Skalecki <ikcelaks@gmail.com>
+// Copyright 2024 QKekos <q.kekos.q@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+
+#include "st_defaults.h"
+#include "qmk_wrapper.h"
+#include "st_assert.h"
+#include "keybuffer.h"
+#include "key_stack.h"
+#include "trie.h"
+#include "completions.h"
+
+#if SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS
+// only for COMPLETION_CHECKPOINT_INTERVAL; the tables are in the trie
+#include "sequence_transform_data.h"
+
+//////////////////////////////////////////////////////////////////
+static uint8_t completion_read_bit(st_completion_reader_t *reader)
+{
+    if ((reader->index & 7) == 0) {
+        reader->byte = CDATA(reader->trie, reader->index >> 3);
+    }
+    const uint8_t bit = (reader->byte >> (7 - (reader->index & 7))) & 1;
+    ++reader->index;
+    return bit;
+}
+#endif
+//////////////////////////////////////////////////////////////////
+// Positions the reader at the start of the completion
+// at `completion_index` (always a triecode index).
+// Entropy coded completions are found by decoding forward
+// from the closest checkpoint.
+void st_completion_reader_init(st_completion_reader_t *reader, const st_trie_t *trie, int completion_index)
+{
+    reader->trie = trie;
+#if SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS
+    const int checkpoint = completion_index / COMPLETION_CHECKPOINT_INTERVAL;
+    st_assert(checkpoint < trie->completion_checkpoint_count, "Invalid completion index: %d", completion_index);
+    reader->index = pgm_read_dword(&trie->completion_checkpoints[checkpoint]);
+    if (reader->index & 7) {
+        reader->byte = CDATA(trie, reader->index >> 3);
+    }
+    for (int skip = completion_index % COMPLETION_CHECKPOINT_INTERVAL; skip > 0; --skip) {
+        st_completion_reader_next(reader);
+    }
+#else
+    reader->index = completion_index;
+#endif
+}
+//////////////////////////////////////////////////////////////////
+// Returns the next triecode of the completion being read
+uint8_t st_completion_reader_next(st_completion_reader_t *reader)
+{
+#if SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS
+    // Canonical Huffman decode: codes of each length are consecutive,
+    // starting from `first`, and their triecodes follow the ones
+    // of all shorter codes in the symbols table
+    const st_trie_t *trie = reader->trie;
+    // codes are at most 16 bits, the generator doesn't entropy code longer ones
+    uint16_t code = 0, first = 0;
+    int symbol_index = 0;
+    for (int len = 0; len < trie->completion_code_max_len; ++len) {
+        code |= completion_read_bit(reader);
+        const int count = pgm_read_byte(&trie->completion_code_counts[len]);
+        if (code - first < count) {
+            return pgm_read_byte(&trie->completion_code_symbols[symbol_index + code - first]);
+        }
+        symbol_index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+    st_assert(false, "Invalid completion code ending at bit %lu", (unsigned long)reader->index);
+    return 0;
+#else
+    return CDATA(reader->trie, reader->index++);
+#endif
+}
+//////////////////////////////////////////////////////////////////
+// Decodes a whole completion, so it can be indexed from either end
+void st_completion_decode(const st_trie_t *trie, int completion_index, int len, uint8_t *dest)
+{
+    st_completion_reader_t reader;
+    st_completion_reader_init(&reader, trie, completion_index);
+    for (int i = 0; i < len; ++i) {
+        dest[i] = st_completion_reader_next(&reader);
+    }
+}
@@ -0,0 +1,19 @@
+// Copyright 2024 Guillaume Stordeur <guillaume.stordeur@gmail.com>
+// Copyright 2024 Matt Skalecki <ikcelaks@gmail.com>
+// Copyright 2024 QKekos <q.kekos.q@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+//////////////////////////////////////////////////////////////////
+// Public API
+
+typedef struct
+{
+    const st_trie_t *trie;      // trie holding the completions data
+    uint32_t        index;      // index of next triecode (bit index if entropy coded)
+    uint8_t         byte;       // completions data byte holding `index` (entropy coded only)
+} st_completion_reader_t;
+
+void    st_completion_reader_init(st_completion_reader_t *reader, const st_trie_t *trie, int completion_index);
+uint8_t st_completion_reader_next(st_completion_reader_t *reader);
+void    st_completion_decode(const st_trie_t *trie, int completion_index, int len, uint8_t *dest);
@@ -3,6 +3,7 @@
 // Copyright 2024 QKekos <q.kekos.q@gmail.com>
 // SPDX-License-Identifier: Apache-2.0
 
+#include "st_defaults.h"
 #include "qmk_wrapper.h"
 #include "triecodes.h"
 #include "keybuffer.h"
@@ -11,8 +12,24 @@
 #include "triecodes.h"
 #include "utils.h"
 #include "cursor.h"
+#include "completions.h"
 #include "st_assert.h"
 
+//////////////////////////////////////////////////////////////////
+// Returns the triecode of the current action's completion at
+// `sub_index`, counting back from the end of the completion
+static uint8_t cursor_get_completion_triecode(const st_cursor_t *cursor,
+                                              const st_trie_payload_t *action,
+                                              int sub_index)
+{
+    const int char_index = action->completion_len - 1 - sub_index;
+    st_assert(char_index >= 0, "Invalid completion char index: %d", char_index);
+#if SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS
+    return cursor->cached_completion[char_index];
+#else
+    return CDATA(cursor->trie, action->completion_index + char_index);
+#endif
+}
 //////////////////////////////////////////////////////////////////
 bool cursor_advance_to_valid_output(st_cursor_t *cursor)
 {
@@ -51,8 +68,7 @@ bool cursor_advance_to_valid_output(st_cursor_t *cursor)
         if (backspaces < action->completion_len) {
             // This action contains the next output key. Find it's sub_pos and return true
             for (cursor->pos.sub_index = 0; cursor->pos.sub_index < backspaces; ++cursor->pos.sub_index) {
-                const int completion_char_index = action->completion_index + action->completion_len - 1 - cursor->pos.sub_index;
-                const uint8_t triecode = CDATA(cursor->trie, completion_char_index);
+                const uint8_t triecode = cursor_get_completion_triecode(cursor, action, cursor->pos.sub_index);
                 if (st_is_trans_seq_ref_triecode(triecode)) {
                     // This is a seq_ref, increment the seq_ref_index
                     ++cursor->seq_ref_index;
@@ -100,11 +116,9 @@ uint8_t st_cursor_get_triecode(st_cursor_t *cursor)
     // This is an output cursor focused on rule matching keypress
     // get the character at the sub_indax of the transform completion
     const st_trie_payload_t *action = st_cursor_get_action(cursor);
-    int completion_char_index = action->completion_index;
-    completion_char_index += action->completion_len - 1 - cursor->pos.sub_index;
-    st_assert(completion_char_index >= 0, "Invalid completion_char_index: %d at Cursor Pos: %d, %d; %d",
-                completion_char_index, cursor->pos.index, cursor->pos.sub_index, cursor->buffer->size);
-    const uint8_t triecode = CDATA(cursor->trie, completion_char_index);
+    st_assert(cursor->pos.sub_index < action->completion_len, "Invalid sub_index at Cursor Pos: %d, %d; %d",
+                cursor->pos.index, cursor->pos.sub_index, cursor->buffer->size);
+    const uint8_t triecode = cursor_get_completion_triecode(cursor, action, cursor->pos.sub_index);
     if (st_is_trans_seq_ref_triecode(triecode)) {
         return st_key_buffer_get_seq_ref(cursor->buffer, cursor->seq_ref_index);
     }
@@ -141,6 +155,12 @@ const st_trie_payload_t *st_cursor_get_action(st_cursor_t *cursor)
         action->func_code = 0;
     } else {
         st_get_payload_from_match_index(cursor->trie, action, keyaction->action_taken);
+#if SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS
+        // Output cursors read completions back to front,
+        // so decode the whole completion up front
+        st_completion_decode(cursor->trie, action->completion_index,
+                             action->completion_len, cursor->cached_completion);
+#endif
     }
     cursor->cache_valid = cursor->pos.index;
     return action;
@@ -182,6 +202,29 @@ bool st_cursor_at_end(const st_cursor_t *cursor)
     return cursor->pos.index >= cursor->buffer->size || cursor->seq_ref_index >= cursor->buffer->seq_ref_capacity;
 }
 //////////////////////////////////////////////////////////////////
+// Returns false only if the cursor is sure to reach the end
+// before `count` more symbols can be read from it
+bool st_cursor_can_supply(const st_cursor_t *cursor, int count)
+{
+    if (cursor->pos.as_output || cursor->buffer->size - cursor->pos.index >= count) {
+        return true;
+    }
+    // An input cursor is converted to an output cursor when it reaches
+    // a key that performed an action, and that key's completion may
+    // supply more symbols than there are keys left in the buffer
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+    // the no-match cache already keeps a running count of those keys
+    return st_key_buffer_count_actions(cursor->buffer, cursor->pos.index) > 0;
+#else
+    for (int i = cursor->pos.index; i < cursor->buffer->size; ++i) {
+        if (st_key_buffer_get(cursor->buffer, i)->action_taken != ST_DEFAULT_KEY_ACTION) {
+            return true;
+        }
+    }
+    return false;
+#endif
+}
+//////////////////////////////////////////////////////////////////
 bool st_cursor_next(st_cursor_t *cursor)
 {
     if (!cursor->pos.as_output) {
@@ -218,8 +261,7 @@ bool st_cursor_next(st_cursor_t *cursor)
     ++cursor->pos.sub_index;
     const st_trie_payload_t *action = st_cursor_get_action(cursor);
     if (action->completion_len > cursor->pos.sub_index) {
-        const int completion_char_index = action->completion_index + action->completion_len - 1 - cursor->pos.sub_index;
-        const uint8_t triecode = CDATA(cursor->trie, completion_char_index);
+        const uint8_t triecode = cursor_get_completion_triecode(cursor, action, cursor->pos.sub_index);
         if (st_is_trans_seq_ref_triecode(triecode)) {
             // This is a seq_ref, increment the seq_ref_index
             ++cursor->seq_ref_index;
@@ -13,6 +13,7 @@ uint16_t                st_cursor_get_matched_rule(st_cursor_t *cursor);
 const st_trie_payload_t *st_cursor_get_action(st_cursor_t *cursor);
 uint8_t                 st_cursor_get_seq_ascii(st_cursor_t *cursor, uint8_t triecode);
 bool                    st_cursor_at_end(const st_cursor_t *cursor);
+bool                    st_cursor_can_supply(const st_cursor_t *cursor, int count);
 bool                    st_cursor_next(st_cursor_t *cursor);
 bool                    st_cursor_convert_to_output(st_cursor_t *cursor);
 st_cursor_pos_t         st_cursor_save(const st_cursor_t *cursor);
@@ -18,6 +18,12 @@
 This program reads from a prepared dictionary file and generates a
 C source file "sequence_transform_data.h"
 with a serialized trie embedded as an array.
+The same data is also written to "sequence_transform_data.bin",
+which host builds can load at runtime (see BLOB_SECTIONS).
+
+Parsed rules and generated outputs are cached by content hash in
+generator/.cache, and output files are only rewritten when their
+bytes change, so running this on every build doesn't force a recompile.
 
 Each line of the dict file defines "sequence -> transformation" pair.
 Blank lines or lines starting with comment string are ignored.
@@ -31,23 +37,32 @@ Examples:
 
 import re
 import textwrap
+import itertools
 import json
+import heapq
+import struct
+import hashlib
+import pickle
+import os
+import tempfile
+from collections import Counter
 from typing import Any, Dict, Iterator, List, Tuple, Callable
-from datetime import date, datetime
+from datetime import date
 from string import digits
 from pathlib import Path
 from argparse import ArgumentParser
 
 
-ST_GENERATOR_VERSION = "SEQUENCE_TRANSFORM_GENERATOR_VERSION_3_1"
+ST_GENERATOR_VERSION = "SEQUENCE_TRANSFORM_GENERATOR_VERSION_3_4"
 
 GPL2_HEADER_C_LIKE = f'''\
 // Copyright {date.today().year} QMK
 // SPDX-License-Identifier: GPL-2.0-or-later
 '''
 
-GENERATED_HEADER_C_LIKE = f'''\
-// This was file generated on {datetime.now().strftime("%Y-%m-%d %H:%M:%S")}.
+# No timestamp, so that unchanged rules give byte identical headers
+GENERATED_HEADER_C_LIKE = '''\
+// This file was generated from rules with content hash {rules_hash}.
 // Do not edit this file directly!
 '''
 
@@ -57,8 +72,60 @@ TRIECODE_TRANSFORM_SEQUENCE_REF_0 = 0x80
 TRIE_MATCH_BIT = 0x80
 TRIE_BRANCH_BIT = 0x40
 TRIE_MULTI_BRANCH_BIT = 0x20
+TRIE_MIN_DEPTH_BIT = 0x10
+TRIE_PAYLOAD_SIZE = 4  # entry of the payload table (see trie.h)
 OUTPUT_FUNC_1 = 1
 OUTPUT_FUNC_COUNT_MAX = 7
+
+# Entropy coded completions store the bit offset of every Nth symbol
+COMPLETION_CHECKPOINT_INTERVAL = 16
+# Longest code the decoder reads (its code is a uint16_t)
+COMPLETION_CODE_MAX_BITS = 16
+
+# Most expensive key contexts kept by the worst case search
+WORST_CASE_CONTEXT_COUNT = 20
+
+# Binary blob: a header followed by the data sections, 4 byte aligned.
+# Header (little-endian): magic, u16 format version, u16 header size,
+# u32 FNV-1a checksum of everything after the header, u32 file size,
+# u16 of each BLOB_STATS, then u32 offset and u32 size of each BLOB_SECTIONS.
+# Must match host/st_blob.h
+BLOB_MAGIC = b'STBL'
+BLOB_FORMAT_VERSION = 4
+BLOB_STATS = [
+    'SEQUENCE_MIN_LENGTH',
+    'SEQUENCE_MAX_LENGTH',
+    'TRANSFORM_MAX_LENGTH',
+    'COMPLETION_MAX_LENGTH',
+    'MAX_BACKSPACES',
+    'COMPLETIONS_SIZE',
+    'COMPLETION_CHECKPOINT_INTERVAL',
+    'TRIECODE_SEQUENCE_TOKEN_0',
+    'TRIECODE_SEQUENCE_METACHAR_0',
+    'TRIECODE_SEQUENCE_REF_TOKEN_0',
+    'SEQUENCE_TOKEN_COUNT',
+    'SEQUENCE_METACHAR_COUNT',
+    'SEQUENCE_REF_TOKEN_COUNT',
+    'TEST_RULE_COUNT',
+    'MULTI_BRANCH_MAX_DEPTH',
+    'PAYLOAD_INDEX_SIZE',
+]
+BLOB_SECTIONS = [
+    'trie',
+    'trie_aligned',
+    'payloads',                 # TRIE_PAYLOAD_SIZE bytes each
+    'completions',
+    'completions_huffman',
+    'completion_code_counts',
+    'completion_code_symbols',
+    'completion_checkpoints',   # u32 little-endian
+    'trigger_keys',
+    'trigger_pair_index',
+    'trigger_pair_rows',
+    'seq_token_ascii_chars',
+    'seq_metachar_ascii_chars',
+    'test_rules',               # null terminated sequence, then transform, for each rule
+]
 max_backspaces = 0
 
 class bcolors:
@@ -150,18 +217,22 @@ def generate_output_func_symbol_map(output_func_symbols) -> Dict[str, int]:
 def parse_file(
     file_name: str, symbol_map: Dict[str, int],
     separator: str, comment: str
-) -> List[Tuple[str, str]]:
+) -> Tuple[List[Tuple[str, str]], List[str], Dict[str, str]]:
     """Parses sequence dictionary file.
     Each line of the file defines one "sequence -> transformation" pair.
     Blank lines or lines starting with the comment string are ignored.
     The function validates that sequences only have characters a-z.
     Overlapping sequences are matched to the longest valid match.
+    Also returns report lines with the number of rules of each regex pattern,
+    and the pattern each regex zone rule was expanded from.
     """
 
-    file_lines = parse_file_lines(file_name, separator, comment)
+    expansions = []
+    file_lines = parse_file_lines(file_name, separator, comment, expansions)
     sequence_set = set()
     duplicated_rules = []
     rules = []
+    rule_lines = {}
 
     for line_number, sequence, transform in file_lines:
         if sequence in sequence_set:
@@ -188,11 +259,21 @@ def parse_file(
 
         rules.append((sequence, transform))
         sequence_set.add(sequence)
+        rule_lines[sequence] = line_number
 
     if duplicated_rules:
         raise SystemExit("\n".join(duplicated_rules))
 
-    return rules
+    report = [
+        f'Regex pattern on line {line_number}: {cyan(pattern)} expanded to {count} rules'
+        for line_number, pattern, count in expansions
+    ]
+    zone_patterns = {line_number: f'line {line_number}: {pattern}' for line_number, pattern, _ in expansions}
+    zones = {
+        sequence: zone_patterns[line_number]
+        for sequence, line_number in rule_lines.items() if line_number in zone_patterns
+    }
+    return rules, report, zones
 
 ###############################################################################
 def add_default_rules(
@@ -335,54 +416,84 @@ def make_sequence_trie(
 
 
 ###############################################################################
-def generate_matches(pattern) -> list[tuple[str, str]]:
-    valid_tokens = f"[\w{SEQ_TOKEN_SYMBOLS}{WORDBREAK_SYMBOL}]"
-
-    square_brackets_group = re.findall(fr"\[({valid_tokens}+)]", pattern)
-    if square_brackets_group:
-        match = square_brackets_group[0]
-
-        return generate_matches(pattern.replace(
-            f"[{match}]",
-            f"({'|'.join(match)})"
-        ))
-
-    patterns = []
-    groups = re.findall(fr"\((?:{valid_tokens}\|?)+\)\??", pattern)
-
-    if not groups:
-        return [("", pattern)]
-
-    match = groups[0]
-    elements = re.findall(f"{valid_tokens}+", match)
+def parse_pattern(pattern: str) -> Tuple[List[List[str]], List[int]]:
+    """Splits a regex zone pattern into segments, each a list of alternatives.
+    Literal text is a segment with a single alternative. `[abc]`, `(ab|c)`
+    and optional `(ab|c)?` groups list theirs ("" last if optional).
+    Returns the segments and the indices of the groups among them.
+    """
+    segments = []
+    groups = []
+    literal = ''
+    i = 0
+    while i < len(pattern):
+        c = pattern[i]
+        if c not in '[(':
+            literal += c
+            i += 1
+            continue
 
-    patterns.extend([
-        (element, pattern.replace(match, element))
-        for element in elements
-    ])
+        end = pattern.find(']' if c == '[' else ')', i + 1)
+        if end == -1:
+            raise ValueError(f'unclosed "{c}"')
+        body = pattern[i + 1:end]
+        if '[' in body or '(' in body:
+            raise ValueError('nested groups are not supported')
+        alternatives = list(body) if c == '[' else [a for a in body.split('|') if a]
+        if not alternatives:
+            raise ValueError(f'empty group "{pattern[i:end + 1]}"')
+        i = end + 1
+        if pattern.startswith('?', i):
+            alternatives.append('')
+            i += 1
+
+        if literal:
+            segments.append([literal])
+            literal = ''
+        groups.append(len(segments))
+        segments.append(alternatives)
+
+    if literal:
+        segments.append([literal])
+    return segments, groups
 
-    if "?" in match:
-        patterns.append(("", pattern.replace(match, "")))
 
-    return patterns
+###############################################################################
+def generate_matches(pattern: str) -> Iterator[Tuple[Tuple[str, ...], str]]:
+    """Lazily yields the alternative chosen for each group and the resulting
+    sequence, for every combination of the pattern's groups."""
+    segments, groups = parse_pattern(pattern)
+    for choice in itertools.product(*segments):
+        yield tuple(choice[i] for i in groups), ''.join(choice)
 
 
 ###############################################################################
-def parse_tokens(tokens: List[str], parse_regex: bool) -> Iterator[Tuple[int, str, str]]:
+def parse_tokens(tokens: List[str], parse_regex: bool) -> Iterator[Tuple[str, str]]:
     full_sequence, transform = tokens
 
-    if parse_regex:
-        for token, sequence in generate_matches(full_sequence):
-            yield sequence, transform.replace(r"\1", token)
-    else:
+    if not parse_regex:
         yield full_sequence, transform
+        return
+
+    # \1 to \9 in the transform are replaced by the alternative of that group
+    seen = set()
+    for group_tokens, sequence in generate_matches(full_sequence):
+        expanded = transform
+        for n in range(9, 0, -1):
+            expanded = expanded.replace(f"\\{n}", group_tokens[n - 1] if n <= len(group_tokens) else "")
+        if (sequence, expanded) not in seen:
+            seen.add((sequence, expanded))
+            yield sequence, expanded
 
 
 ###############################################################################
 def parse_file_lines(
-    file_name: str, separator: str, comment: str
+    file_name: str, separator: str, comment: str, expansions: List[Tuple[int, str, int]]
 ) -> Iterator[Tuple[int, str, str]]:
-    """Parses lines read from `file_name` into sequence-transform pairs."""
+    """Parses lines read from `file_name` into sequence-transform pairs.
+    Appends the line, pattern and number of rules of each regex zone pattern
+    to `expansions` once its rules are all yielded.
+    """
     with open(file_name, 'rt', encoding="utf-8") as file:
         lines = file.readlines()
 
@@ -414,8 +525,17 @@ def parse_file_lines(
                     f'{err(line_number)}: Invalid syntax: "{red(line)}"'
                 )
 
-            for sequence, transform in parse_tokens(tokens, in_regex_zone):
-                yield line_number, sequence, transform
+            count = 0
+            try:
+                for sequence, transform in parse_tokens(tokens, in_regex_zone):
+                    count += 1
+                    yield line_number, sequence, transform
+            except ValueError as e:
+                raise SystemExit(
+                    f'{err(line_number)}: Invalid pattern "{red(line)}": {e}'
+                )
+            if in_regex_zone:
+                expansions.append((line_number, tokens[0], count))
 
 
 ###############################################################################
@@ -454,55 +574,194 @@ def serialize_outputs(
 
 
 ###############################################################################
-def serialize_sequence_trie(
-    symbol_map: Dict[str, int], trie: Dict[str, Any],
-    completions_map: Dict[str, int]
-) -> List[int]:
-    """Serializes trie in a form readable by the C code.
+def encode_completions(
+    completions_data: List[int]
+) -> Tuple[List[int], List[int], List[int], List[int]]:
+    """Entropy codes the completions buffer with a canonical Huffman code.
 
     Returns:
-    List of 16bit ints in the range 0-64k.
+    - code bitstream, most significant bit first
+    - number of codes of each length, starting from length 1
+    - triecodes in canonical code order
+    - bit offset of every COMPLETION_CHECKPOINT_INTERVAL'th triecode
+
+    All four are empty if some code would be longer than the decoder reads
+    (COMPLETION_CODE_MAX_BITS), the completions are then only stored raw.
     """
-    table = []
+    freqs = Counter(completions_data)
+    code_lens = {sym: 0 for sym in freqs}
+    heap = [(freq, sym, [sym]) for sym, freq in freqs.items()]
+    heapq.heapify(heap)
+    tiebreak = 0x100
+
+    while len(heap) > 1:
+        freq1, _, syms1 = heapq.heappop(heap)
+        freq2, _, syms2 = heapq.heappop(heap)
+        for sym in syms1 + syms2:
+            code_lens[sym] += 1
+        heapq.heappush(heap, (freq1 + freq2, tiebreak, syms1 + syms2))
+        tiebreak += 1
+
+    # A lone symbol still needs a 1 bit code
+    code_lens = {sym: max(1, code_len) for sym, code_len in code_lens.items()}
+    max_code_len = max(code_lens.values(), default=1)
+    if max_code_len > COMPLETION_CODE_MAX_BITS:
+        return [], [], [], []
+
+    symbols = sorted(freqs, key=lambda sym: (code_lens[sym], sym))
+    code_counts = [0] * max_code_len
+    codes = {}
+    code, prev_len = 0, 1
+
+    for sym in symbols:
+        code <<= code_lens[sym] - prev_len
+        prev_len = code_lens[sym]
+        codes[sym] = code
+        code_counts[prev_len - 1] += 1
+        code += 1
+
+    bits = []
+    checkpoints = []
+
+    for i, sym in enumerate(completions_data):
+        if i % COMPLETION_CHECKPOINT_INTERVAL == 0:
+            checkpoints.append(len(bits))
+
+        bits += [(codes[sym] >> n) & 1 for n in reversed(range(code_lens[sym]))]
+
+    # checkpoints are stored as uint32_t
+    assert len(bits) <= 0xffffffff
+    bits += [0] * (-len(bits) % 8)
+    bitstream = [
+        int(''.join(map(str, bits[i:i + 8])), 2) for i in range(0, len(bits), 8)
+    ]
 
-    def build_chain_match(sub_rule, match):
-        return {
-            'SUB_RULE': sub_rule,
-            'DATA': build_match(match)
-        }
+    return bitstream, code_counts, symbols, checkpoints
 
-    def build_match(match, more_branching = False):
-        global max_backspaces
 
-        action = match['ACTION']
+###############################################################################
+def build_payload_table(
+    trie: Dict[str, Any], completions_map: Dict[str, int]
+) -> Tuple[List[int], Dict[Tuple[int, int, int], int], int]:
+    """Collects the unique payloads of all matches and chained matches,
+    so the trie only stores their index (see st_get_payload_from_match_index).
+
+    Each payload is TRIE_PAYLOAD_SIZE bytes: the code byte (function and
+    backspaces), the completion length, and the completion index (big-endian).
+
+    Returns:
+    The payload table, the index of each payload and the number of
+    payload references in the trie.
+    """
+    payloads_map = {}
+    refs = 0
 
+    def add(match):
+        global max_backspaces
+        nonlocal refs
+        action = match['ACTION']
         backspaces = action['BACKSPACES']
         max_backspaces = max(max_backspaces, backspaces)
         func = action['FUNC']
         completion = action['COMPLETION']
-        completion_index = completions_map[completion]
-
-        # 1 bit reserved for marking if trie branching continues
-        code = 0x80 if more_branching else 0
 
         # 2 bits (6..5) are used for special function
         assert 0 <= func < 4
-        code += func << 5
-
         # 5 bits (4..0) are used for backspaces
         assert 0 <= backspaces < 32
-        code += backspaces
-
         # 8 bits (bits 7..0) are used for completion_len
-        completion_len = len(completion)
-        assert 0 <= completion_len < 256
-        completion_len
+        assert 0 <= len(completion) < 256
+
+        payload = ((func << 5) + backspaces, len(completion), completions_map[completion])
+        payloads_map.setdefault(payload, len(payloads_map))
+        refs += 1
+
+    def traverse(trie_node):
+        if 'MATCH' in trie_node:
+            add(trie_node['MATCH'])
+        for cmatch in trie_node['CHAIN']:
+            add(cmatch['MATCH'])
+        for child in trie_node['TOKEN'].values():
+            traverse(child)
+
+    traverse(trie)
+    if len(payloads_map) > 0x10000:
+        raise SystemExit(f'{err()} Impressive. More than 65536 unique rule actions')
+    payload_data = [b for code, completion_len, completion_index in payloads_map
+                    for b in [code, completion_len] + encode_word(completion_index, False)]
+    return payload_data, payloads_map, refs
+
+
+def payload_index_size(payloads_map: Dict[Tuple[int, int, int], int], refs: int) -> int:
+    """Bytes of the payload index stored by each match, or 0 to store
+    the payloads in the trie, if the table wouldn't save any bytes
+    (or the config's payload_table is false)."""
+    index_size = 1 if len(payloads_map) <= 0x100 else 2
+    saved = (TRIE_PAYLOAD_SIZE - index_size) * refs - TRIE_PAYLOAD_SIZE * len(payloads_map)
+    if PAYLOAD_TABLE is False or (PAYLOAD_TABLE != True and saved <= 0):
+        return 0
+    return index_size
+
+
+def serialize_sequence_trie(
+    symbol_map: Dict[str, int], trie: Dict[str, Any],
+    completions_map: Dict[str, int], payloads_map: Dict[Tuple[int, int, int], int], refs: int,
+    aligned: bool = False, layout: List[Dict[str, Any]] = None
+) -> List[int]:
+    """Serializes trie in a form readable by the C code.
+
+    Matches are stored as an index into the payload table built by
+    build_payload_table, padded to 2 bytes if `aligned` is set, or as
+    the payload itself if payload_index_size is 0.
+
+    If `aligned` is set, all 16bit values are stored little-endian at even
+    offsets, so that 32bit targets can read them with a single load
+    (see SEQUENCE_TRANSFORM_TRIE_ALIGNED).
+
+    If `layout` is given, it receives the serialized node entries in order
+    (see trie_stats).
+
+    Returns:
+    List of 16bit ints in the range 0-64k.
+    """
+    table = []
 
-        completion_index_byte1, completion_index_byte2 = divmod(completion_index, 0x100)
+    def padding(offset: int) -> List[int]:
+        return [0] * (offset % 2) if aligned else []
 
-        # First output word stores coded info
-        # Second stores completion data offset index
-        return [code, completion_len, completion_index_byte1, completion_index_byte2]
+    def build_chain_match(sub_rule, match):
+        return {
+            'SUB_RULE': sub_rule,
+            'DATA': build_match(match)
+        }
+
+    index_size = payload_index_size(payloads_map, refs)
+
+    def build_match(match):
+        action = match['ACTION']
+        completion = action['COMPLETION']
+        code, completion_len, completion_index = payload = (
+            (action['FUNC'] << 5) + action['BACKSPACES'], len(completion), completions_map[completion]
+        )
+        if index_size == 0:
+            # First output word stores coded info
+            # Second stores completion data offset index
+            return [code, completion_len] + encode_word(completion_index, aligned)
+        if index_size == 2:
+            return encode_word(payloads_map[payload], aligned)
+        return [payloads_map[payload]] + padding(1)
+
+    def min_match_depth(trie_node) -> int:
+        """Number of symbols that must still be matched below `trie_node`
+        before any rule can match."""
+        if 'MIN_DEPTH' not in trie_node:
+            if 'MATCH' in trie_node or len(trie_node['CHAIN']) > 0:
+                trie_node['MIN_DEPTH'] = 0
+            else:
+                trie_node['MIN_DEPTH'] = 1 + min(
+                    min_match_depth(child) for child in trie_node['TOKEN'].values()
+                )
+        return trie_node['MIN_DEPTH']
 
     # Traverse trie in depth first order.
     def traverse(trie_node):
@@ -538,7 +797,7 @@ def serialize_sequence_trie(
         if has_match:
             # Node has at lest one match, and or chained match
             # serialize the match node
-            entry['match_data'] = build_match(trie_node['MATCH'], token_count > 0)
+            entry['match_data'] = build_match(trie_node['MATCH'])
             entry['match_node'] = trie_node['MATCH']
 
         chain_data = []
@@ -564,12 +823,23 @@ def serialize_sequence_trie(
                 # print(f"Singe-chain: Char {c}\n{json.dumps(trie_node, indent=4)}")
                 entry['str'] += c
 
+            # Only annotate the chain with its minimum depth when a match
+            # can't occur right at its end. Otherwise, the chain itself
+            # already stops the search when the buffer runs out.
+            chain_min_depth = len(entry['str']) + min_match_depth(trie_node)
+            if chain_min_depth > len(entry['str']):
+                entry['min_depth'] = chain_min_depth
+
             table.append(entry)
             entry['links'] = [traverse(trie_node)]
 
         elif token_count > 0:  # Handle trie node with multiple children.
             entry['chars'] = ''.join(sorted(trie_node['TOKEN'].keys(), key=lambda k : symbol_map[k]))
 
+            branch_min_depth = 1 + min(min_match_depth(child) for child in trie_node['TOKEN'].values())
+            if branch_min_depth > 1:
+                entry['min_depth'] = branch_min_depth
+
             table.append(entry)
             # print(f"branch node: {json.dumps(entry, indent=4)}")
             entry['links'] = [traverse(trie_node['TOKEN'][c]) for c in entry['chars']]
@@ -583,65 +853,529 @@ def serialize_sequence_trie(
     traverse(trie)
     # quiet_print(f'{err(0)} Data "{cyan(table)}"')
 
-    def serialize(node: Dict[str, Any]) -> List[int]:
+    def serialize(node: Dict[str, Any], offset: int) -> List[int]:
         # print(f"{json.dumps(node, indent=4)}")
         data = []
         # data = node['data']
         # quiet_print(f'{err(0)} Serialize Data "{cyan(data)}"')
         if 'node_header_data' in node:
             data = data + node['node_header_data']
+            data = data + padding(offset + len(data))
 
         if 'match_data' in node:
             data = data + node['match_data']
 
         if 'chain_data' in node:
             for cmatch, _ in node['chain_data']:
-                data = data + encode_link(cmatch['SUB_RULE']) + \
+                data = data + encode_link(cmatch['SUB_RULE'], aligned) + \
                     cmatch['DATA']
 
+        # Chain and branch headers may be followed by a byte holding
+        # the minimum number of symbols needed to reach a match
+        def encode_header(code):
+            if 'min_depth' in node:
+                return [code | TRIE_MIN_DEPTH_BIT, min(node['min_depth'], 0xff)]
+            return [code]
+
         if 'str' in node:  # Handle a chain table entry.
-            return data + [1] + [symbol_map[c] for c in node['str']] + [0]
+            return data + encode_header(1) + [symbol_map[c] for c in node['str']] + [0]
 
         if 'chars' in node:  # Handle a branch table entry.
             code = TRIE_BRANCH_BIT
             if any([(symbol_map[c] & TRIECODE_SEQUENCE_METACHAR_0) == TRIECODE_SEQUENCE_METACHAR_0 for c in node['chars']]):
                 code = code | TRIE_MULTI_BRANCH_BIT
-            links = [code]
+            links = encode_header(code)
+            links += padding(offset + len(data) + len(links))
 
             for c, link in zip(node['chars'], node['links']):
-                links += [symbol_map[c]] + encode_link(link['node'])
+                links += [symbol_map[c]] + padding(1) + encode_link(link['node'], aligned)
 
             return data + links + [0]
 
         return data
 
-    uint16_offset = 0
+    def compute_offsets():
+        uint16_offset = 0
+
+        # To encode links, first compute byte offset of each entry.
+        for table_entry in table:
+            table_entry['node']['OFFSET'] = uint16_offset
+            temp_uint16_offset = uint16_offset + len(table_entry.get('node_header_data', []))
+            temp_uint16_offset += len(padding(temp_uint16_offset))
+            if 'match_data' in table_entry:
+                table_entry['match_node']['OFFSET'] = temp_uint16_offset
+                temp_uint16_offset += len(table_entry['match_data'])
+            if 'chain_data' in table_entry:
+                # print(f"offset chain_data {table_entry['chain_data']}")
+                for cmatch, cnode in table_entry['chain_data']:
+                    cnode['OFFSET'] = temp_uint16_offset + 2
+                    temp_uint16_offset += 2 + len(cmatch['DATA'])
+
+            uint16_offset += len(serialize(table_entry, uint16_offset))
+
+            assert 0 <= uint16_offset <= 0xffff
+
+    def sort_chain_data() -> bool:
+        changed = False
+        for table_entry in table:
+            if 'chain_data' not in table_entry:
+                continue
+            chain_data = table_entry['chain_data']
+            sorted_chain_data = sorted(chain_data, key=lambda c: c[0]['SUB_RULE']['OFFSET'])
+            if any(a is not b for a, b in zip(sorted_chain_data, chain_data)):
+                table_entry['chain_data'] = sorted_chain_data
+                changed = True
+        return changed
+
+    # The C code binary searches the chained matches of a node by sub-rule
+    # offset, so they must be sorted. Sorting moves chained matches, which
+    # can themselves be sub-rules of longer chained rules, so repeat until
+    # the layout is stable. Sub-rules are always shorter than the rules
+    # chained to them, so this takes at most SEQUENCE_MAX_LENGTH passes.
+    compute_offsets()
+    while sort_chain_data():
+        compute_offsets()
 
-    # To encode links, first compute byte offset of each entry.
-    for table_entry in table:
-        table_entry['node']['OFFSET'] = uint16_offset
-        temp_uint16_offset = uint16_offset + len(table_entry.get('node_header_data', []))
-        if 'match_data' in table_entry:
-            table_entry['match_node']['OFFSET'] = temp_uint16_offset
-            temp_uint16_offset += len(table_entry['match_data'])
-        if 'chain_data' in table_entry:
-            # print(f"offset chain_data {table_entry['chain_data']}")
-            for cmatch, cnode in table_entry['chain_data']:
-                cnode['OFFSET'] = temp_uint16_offset + 2
-                temp_uint16_offset += 2 + len(cmatch['DATA'])
+    # Serialize final table.
+    trie_data = [b for node in table for b in serialize(node, node['node']['OFFSET'])]
 
-        uint16_offset += len(serialize(table_entry))
+    if layout is not None:
+        layout.extend(table)
 
-        assert 0 <= uint16_offset <= 0xffff
+    return trie_data
 
-    # Serialize final table.
-    trie_data = [b for node in table for b in serialize(node)]
 
-    return trie_data
+###############################################################################
+def multi_branch_max_depth(symbol_map: Dict[str, int], trie: Dict[str, Any]) -> int:
+    """Most multi-branch nodes (branches with a metachar entry) on any path
+    from the root. st_find_longest_chain keeps one backtrack entry for each
+    multi-branch on its current path, so this bounds its stack."""
+    def depth(trie_node) -> int:
+        children = trie_node['TOKEN']
+        below = max((depth(child) for child in children.values()), default=0)
+        is_multi_branch = len(children) > 1 and any(
+            (symbol_map[c] & TRIECODE_SEQUENCE_METACHAR_0) == TRIECODE_SEQUENCE_METACHAR_0
+            for c in children
+        )
+        return below + is_multi_branch
+
+    return depth(trie)
+
+
+###############################################################################
+def trie_stats(
+    symbol_map: Dict[str, int], layout: List[Dict[str, Any]], trie_size: int,
+    completions_map: Dict[str, int], completions_size: int
+) -> Dict[str, Any]:
+    """Shape of the serialized (packed) trie, and the cost of each rule.
+
+    Bytes of a node's match or chained match belong to its rule. The rest of
+    a node (header, chain symbols, branch entries) is shared evenly by the
+    rules matched below it, or by the node's own rules if it is a leaf.
+    Completion bytes are shared by the rules whose completions overlap them.
+    Node visits count the nodes and branch entries read on the way to a
+    rule's match, with every entry of a multi-branch and a binary search
+    of the chained matches.
+    """
+    offsets = [entry['node']['OFFSET'] for entry in layout] + [trie_size]
+    sizes = {id(entry): offsets[i + 1] - offsets[i] for i, entry in enumerate(layout)}
+    depth_histogram = Counter()
+    fanout_histogram = Counter()
+    chain_run_histogram = Counter()
+    chained_check_histogram = Counter()
+    multi_branch_nodes = 0
+    rules = {}
+    subtree_rules_memo = {}
+
+    def rule(match) -> Dict[str, Any]:
+        return rules.setdefault(match['SEQUENCE'], {
+            'sequence': match['SEQUENCE'],
+            'transform': match['TRANSFORM'],
+            'completion': match['ACTION']['COMPLETION'],
+            'trie_bytes': 0.0,
+            'completion_bytes': 0.0,
+            'node_visits': 0,
+        })
+
+    def own_matches(entry) -> List[Dict[str, Any]]:
+        matches = [entry['match_node']] if 'match_node' in entry else []
+        return matches + [match for _, match in entry.get('chain_data', [])]
+
+    def subtree_rules(entry) -> List[Dict[str, Any]]:
+        if id(entry) not in subtree_rules_memo:
+            matches = own_matches(entry)
+            for link in entry.get('links', []):
+                matches = matches + subtree_rules(link)
+            subtree_rules_memo[id(entry)] = matches
+        return subtree_rules_memo[id(entry)]
+
+    def share(matches, size):
+        for match in matches:
+            rule(match)['trie_bytes'] += size / len(matches)
+
+    def walk(entry, depth, visits):
+        nonlocal multi_branch_nodes
+        size = sizes[id(entry)]
+        visits += 1
+        depth_histogram[depth] += 1
+        if 'match_node' in entry:
+            rule(entry['match_node'])['trie_bytes'] += len(entry['match_data'])
+            rule(entry['match_node'])['node_visits'] = visits
+            size -= len(entry['match_data'])
+        chain_data = entry.get('chain_data', [])
+        if chain_data:
+            chained_check_histogram[len(chain_data)] += 1
+            for cmatch, match in chain_data:
+                rule(match)['trie_bytes'] += 2 + len(cmatch['DATA'])
+                rule(match)['node_visits'] = visits + len(chain_data).bit_length()
+                size -= 2 + len(cmatch['DATA'])
+        links = entry.get('links', [])
+        if 'chars' in entry:
+            fanout_histogram[len(links)] += 1
+            is_multi_branch = any(
+                (symbol_map[c] & TRIECODE_SEQUENCE_METACHAR_0) == TRIECODE_SEQUENCE_METACHAR_0
+                for c in entry['chars']
+            )
+            multi_branch_nodes += is_multi_branch
+            for i, link in enumerate(links):
+                share(subtree_rules(link), 3)
+                size -= 3
+                walk(link, depth + 1, visits + (len(links) if is_multi_branch else i + 1))
+        elif 'str' in entry:
+            chain_run_histogram[len(entry['str'])] += 1
+            walk(links[0], depth + len(entry['str']), visits)
+        below = [match for link in links for match in subtree_rules(link)]
+        share(below or own_matches(entry), size)
+
+    walk(layout[0], 0, 0)
+
+    # Each completion byte is shared by the rules whose completion covers it
+    coverage = [0] * completions_size
+    for r in rules.values():
+        start = completions_map[r['completion']]
+        for i in range(start, start + len(r['completion'])):
+            coverage[i] += 1
+    for r in rules.values():
+        start = completions_map[r['completion']]
+        r['completion_bytes'] = sum(1 / coverage[i] for i in range(start, start + len(r['completion'])))
+
+    completion_chars = sum(len(r['completion']) for r in rules.values())
+    return {
+        'trie_bytes': trie_size,
+        'node_count': len(layout),
+        'depth_histogram': dict(sorted(depth_histogram.items())),
+        'branch_fanout_histogram': dict(sorted(fanout_histogram.items())),
+        'chain_run_histogram': dict(sorted(chain_run_histogram.items())),
+        'chained_check_histogram': dict(sorted(chained_check_histogram.items())),
+        'multi_branch_nodes': multi_branch_nodes,
+        'completions_bytes': completions_size,
+        'completion_chars': completion_chars,
+        'completion_reuse_ratio': completion_chars / completions_size if completions_size else 0.0,
+        'rules': sorted(rules.values(), key=lambda r: r['sequence']),
+    }
 
 
 ###############################################################################
-def encode_link(link: Dict[str, Any]) -> List[int]:
+def regex_zone_stats(rules: List[Dict[str, Any]], zones: Dict[str, str]) -> Dict[str, Dict[str, Any]]:
+    """Sums the rule costs of trie_stats over each regex zone pattern."""
+    zone_stats = {}
+    for r in rules:
+        if r['sequence'] in zones:
+            zone = zone_stats.setdefault(zones[r['sequence']], {'rules': 0, 'bytes': 0.0, 'node_visits': 0})
+            zone['rules'] += 1
+            zone['bytes'] += r['trie_bytes'] + r['completion_bytes']
+            zone['node_visits'] = max(zone['node_visits'], r['node_visits'])
+    return zone_stats
+
+
+###############################################################################
+def format_stats(stats: Dict[str, Any], top: int = 10) -> List[str]:
+    """Human readable --stats report, with the costliest rules and regex zones."""
+    def histogram(counts: Dict[int, int]) -> str:
+        return ', '.join(f'{k}: {v}' for k, v in counts.items()) or 'none'
+
+    def cost(r) -> float:
+        return r['trie_bytes'] + r['completion_bytes']
+
+    report = [
+        f'--- TRIE STATS ---',
+        f'Trie: {stats["trie_bytes"]} bytes in {stats["node_count"]} nodes, '
+        f'{stats["multi_branch_nodes"]} multi-branch',
+        f'Node depth (symbols: nodes): {histogram(stats["depth_histogram"])}',
+        f'Branch fanout (children: nodes): {histogram(stats["branch_fanout_histogram"])}',
+        f'Chain runs (symbols: nodes): {histogram(stats["chain_run_histogram"])}',
+        f'Chained checks (checks: nodes): {histogram(stats["chained_check_histogram"])}',
+        f'Completions: {stats["completions_bytes"]} bytes hold {stats["completion_chars"]} chars '
+        f'of completions ({stats["completion_reuse_ratio"]:.2f}x reuse)',
+        f'Costliest rules (trie + completion bytes, node visits):',
+    ]
+    rules = stats['rules']
+    for r in sorted(rules, key=cost, reverse=True)[:top]:
+        report.append(
+            f'  {r["trie_bytes"]:6.1f} + {r["completion_bytes"]:5.1f}  {r["node_visits"]:3}  '
+            f'{cyan(r["sequence"])} {SEP_STR} {r["transform"]}'
+        )
+    report.append(f'Most node visits:')
+    for r in sorted(rules, key=lambda r: (r['node_visits'], cost(r)), reverse=True)[:top]:
+        report.append(f'  {r["node_visits"]:3}  {cyan(r["sequence"])} {SEP_STR} {r["transform"]}')
+
+    if stats['regex_zones']:
+        report.append(f'Costliest regex zone patterns (rules, bytes, most node visits):')
+        zones = sorted(stats['regex_zones'].items(), key=lambda z: z[1]['bytes'], reverse=True)
+        for pattern, zone in zones[:top]:
+            report.append(f'  {zone["rules"]:4}  {zone["bytes"]:7.1f}  {zone["node_visits"]:3}  {cyan(pattern)}')
+    return report
+
+
+###############################################################################
+def format_worst_case(worst: Dict[str, Any], top: int) -> List[str]:
+    """Human readable --worst-case report."""
+    report = [
+        f'--- WORST CASE KEY SEARCH ---',
+        f'Upper bounds over {worst["contexts_searched"]} key contexts: '
+        f'{worst["max_flash_reads"]} trie bytes read, {worst["max_node_visits"]} nodes visited, '
+        f'{worst["max_branches_followed"]} multi-branch entries followed',
+        f'(bytes read are the same with SEQUENCE_TRANSFORM_TRIE_ALIGNED, whose padding is never read)',
+        f'Costliest contexts (bytes read, nodes, multi-branch entries):',
+    ]
+    for c in worst['worst_contexts'][:top]:
+        context = c['context'] if c['context'] is not None else f'triecodes {c["triecodes"]}'
+        report.append(f'  {c["flash_reads"]:4}  {c["node_visits"]:3}  {c["branches_followed"]:2}  {cyan(repr(context))}')
+    return report
+
+
+###############################################################################
+def write_worst_case_contexts(file_name: str, worst: Dict[str, Any]):
+    """Writes the contexts the tester can replay (tester -w FILE)."""
+    with open(file_name, 'wt', encoding="utf-8") as file:
+        file.write('# flash_reads node_visits branches_followed context (typed oldest first)\n')
+        for c in worst['worst_contexts']:
+            if c['context'] is not None:
+                file.write(f'{c["flash_reads"]} {c["node_visits"]} {c["branches_followed"]} {c["context"]}\n')
+
+
+###############################################################################
+def search_alphabet() -> List[Tuple[int, str]]:
+    """Every triecode a key can add to the buffer, with the char that types
+    it in the tester (None if there is none), lowercase letters first."""
+    tokens = [(TRIECODE_SEQUENCE_TOKEN_0 + i, c) for i, c in enumerate(SEQ_TOKEN_ASCII_CHARS)]
+    ascii = [
+        (c, chr(c) if ' ' <= chr(c) <= '~' and chr(c) not in SEQ_TOKEN_ASCII_CHARS else None)
+        for c in range(1, TRIECODE_SEQUENCE_TOKEN_0)
+    ]
+    return sorted(ascii + tokens, key=lambda symbol: (symbol[1] is None, not (symbol[1] or '').islower()))
+
+
+###############################################################################
+def worst_case_search(
+    trie_data: List[int], index_size: int, alphabet: List[Tuple[int, str]], top: int
+) -> Dict[str, Any]:
+    """Upper bounds on the work st_find_longest_chain does for one key.
+
+    Walks the serialized (packed) trie like the C code, for every sequence
+    of symbols the cursor can read, most recent first. Matches hold a
+    payload index of `index_size` bytes. `alphabet` lists the
+    symbols, each with the char that types it in the tester (or None), in
+    order of preference. Symbols that lead every search path to the same
+    nodes at the same cost are only tried once.
+
+    Counts bytes of trie data read, nodes visited and multi-branch entries
+    followed (each is a backtrack point). Buffer length pruning and chained
+    matches ending the search early are ignored, so these are upper bounds.
+    A chained match check can only happen at the first key that performed
+    an action, so the costliest single key's checks are added to each
+    context.
+
+    Returns the maxima, and the `top` contexts with the most reads as
+    strings in typing order.
+    """
+    memo = {}
+
+    def advance(pos: Tuple[bool, int], triecode: int):
+        """Reads from pos, a node offset or (if in_chain) a chain symbol
+        offset, with the cursor on `triecode`. Returns the reads, visits,
+        branches followed, chained check reads and the next positions."""
+        if (pos, triecode) in memo:
+            return memo[(pos, triecode)]
+        in_chain, offset = pos
+        reads = visits = branches = checks = 0
+        next_positions = []
+        while True:
+            if in_chain:
+                code = trie_data[offset]
+                reads += 1
+                if not code:
+                    # end of the chain, a node follows
+                    in_chain, offset = False, offset + 1
+                    continue
+                if triecode_matches(code, triecode):
+                    next_positions.append((True, offset + 1))
+                break
+
+            header = trie_data[offset]
+            visits += 1
+            reads += 1
+            offset += 1
+            chain_check_count = header & 0x0f
+            if header & TRIE_MIN_DEPTH_BIT:
+                if header & TRIE_MATCH_BIT:
+                    chain_check_count = (chain_check_count << 8) + trie_data[offset]
+                offset += 1
+                reads += 1
+
+            if header & TRIE_MATCH_BIT:
+                if header & TRIE_MULTI_BRANCH_BIT:  # unchained match
+                    offset += index_size
+                # binary search of the chained matches, 2 bytes per probe
+                checks += 2 * chain_check_count.bit_length()
+                offset += (2 + index_size) * chain_check_count
+                if not header & TRIE_BRANCH_BIT:
+                    break
+            elif header & TRIE_BRANCH_BIT:
+                is_multi_branch = header & TRIE_MULTI_BRANCH_BIT
+                for entry in range(offset, len(trie_data), 3):
+                    code = trie_data[entry]
+                    reads += 1
+                    if not code:
+                        break
+                    if code == triecode or (is_multi_branch and triecode_matches(code, triecode)):
+                        reads += 2
+                        branches += bool(is_multi_branch)
+                        next_positions.append((False, (trie_data[entry + 1] << 8) + trie_data[entry + 2]))
+                        if not is_multi_branch:
+                            break
+                break
+            else:
+                in_chain = True
+
+        memo[(pos, triecode)] = (reads, visits, branches, checks, next_positions)
+        return memo[(pos, triecode)]
+
+    worst = []
+    maxima = {'flash_reads': 0, 'node_visits': 0, 'branches_followed': 0}
+    leaf_count = 0
+
+    def search(positions, symbols, reads, visits, branches, checks):
+        nonlocal leaf_count
+        # group the symbols by what they do to every search path
+        outcomes = {}
+        for triecode, replay in alphabet:
+            cost = [0, 0, 0, 0]
+            next_positions = []
+            for pos in positions:
+                *pos_cost, pos_next = advance(pos, triecode)
+                cost = [a + b for a, b in zip(cost, pos_cost)]
+                next_positions += pos_next
+            outcomes.setdefault((tuple(sorted(next_positions)), *cost), (triecode, replay))
+
+        for (next_positions, key_reads, key_visits, key_branches, key_checks), symbol in outcomes.items():
+            context = symbols + [symbol]
+            totals = (reads + key_reads, visits + key_visits, branches + key_branches, max(checks, key_checks))
+            if next_positions:
+                search(next_positions, context, *totals)
+                continue
+            leaf_count += 1
+            flash_reads = totals[0] + totals[3]
+            result = {
+                'flash_reads': flash_reads,
+                'node_visits': totals[1],
+                'branches_followed': totals[2],
+                'chain_check_reads': totals[3],
+                # typing order is oldest key first
+                'context': None if any(r is None for _, r in context) else ''.join(r for _, r in reversed(context)),
+                'triecodes': [t for t, _ in reversed(context)],
+            }
+            for name in maxima:
+                maxima[name] = max(maxima[name], result[name])
+            entry = (flash_reads, totals[1], leaf_count, result)
+            if len(worst) < top:
+                heapq.heappush(worst, entry)
+            elif entry > worst[0]:
+                heapq.heapreplace(worst, entry)
+
+    search([(False, 0)], [], 0, 0, 0, 0)
+    return {
+        **{f'max_{name}': value for name, value in maxima.items()},
+        'contexts_searched': leaf_count,
+        'worst_contexts': [entry[-1] for entry in sorted(worst, reverse=True)],
+    }
+
+
+###############################################################################
+def triecode_matches(code: int, triecode: int) -> bool:
+    """Python version of st_match_triecode (see predicates.c)"""
+    if code < TRIECODE_SEQUENCE_METACHAR_0:
+        return code == triecode
+
+    is_upper_alpha = ord('A') <= triecode <= ord('Z')
+    is_alpha = is_upper_alpha or ord('a') <= triecode <= ord('z')
+    is_terminating_punct = triecode in b'.!?'
+    is_nonterminating_punct = triecode in b',;:'
+
+    return [
+        is_upper_alpha,
+        is_alpha,
+        ord('0') <= triecode <= ord('9'),
+        is_terminating_punct,
+        is_nonterminating_punct,
+        is_terminating_punct or is_nonterminating_punct,
+        triecode < 0x80 and not is_alpha,
+        True
+    ][code - TRIECODE_SEQUENCE_METACHAR_0]
+
+
+###############################################################################
+def serialize_trigger_tables(
+    symbol_map: Dict[str, int], trie: Dict[str, Any]
+) -> Tuple[List[int], List[int], List[int]]:
+    """Builds bitsets of the triecodes that can end a sequence.
+
+    Returns:
+    - 256 bit set of the triecodes that can be the last key of a sequence
+    - index of the row in the pair table for each of those triecodes
+    - pair table rows: 256 bit sets of the triecodes that can come right
+      before the last key. Row 0 accepts any triecode, and is used when
+      a sequence can be just one key long.
+    """
+    def matching_children(node, triecode):
+        return [
+            child for c, child in node['TOKEN'].items()
+            if triecode_matches(symbol_map[c], triecode)
+        ]
+
+    trigger_keys = [0] * 32
+    pair_index = [0] * 256
+    pair_rows = [[0xff] * 32]
+
+    for triecode in range(256):
+        children = matching_children(trie, triecode)
+        if not children:
+            continue
+
+        trigger_keys[triecode // 8] |= 1 << (triecode % 8)
+        # Chained matches are not considered here, because they can only match
+        # when the previous key performed an action, and those keys are never
+        # filtered by the pair table
+        if any('MATCH' in child for child in children):
+            continue
+
+        row = [0] * 32
+        for prev_triecode in range(256):
+            if any(matching_children(child, prev_triecode) for child in children):
+                row[prev_triecode // 8] |= 1 << (prev_triecode % 8)
+
+        if row not in pair_rows:
+            if len(pair_rows) > 0xff:
+                # Out of row indexes; fall back to accepting any previous key
+                continue
+            pair_rows.append(row)
+        pair_index[triecode] = pair_rows.index(row)
+
+    return trigger_keys, pair_index, [b for row in pair_rows for b in row]
+
+
+###############################################################################
+def encode_link(link: Dict[str, Any], aligned: bool) -> List[int]:
     """Encodes a node link as two bytes."""
     # print(f"{json.dumps(link, indent=4)}")
     uint16_offset = link['OFFSET']
@@ -653,9 +1387,15 @@ def encode_link(link: Dict[str, Any]) -> List[int]:
             f'Try reducing the transforming dict to fewer entries.'
         )
 
-    offset_byte1, offset_byte2 = divmod(uint16_offset, 0x100)
+    return encode_word(uint16_offset, aligned)
+
+
+###############################################################################
+def encode_word(value: int, little_endian: bool) -> List[int]:
+    """Encodes a 16bit value as two bytes."""
+    byte1, byte2 = divmod(value, 0x100)
 
-    return [offset_byte1, offset_byte2]
+    return [byte2, byte1] if little_endian else [byte1, byte2]
 
 
 ###############################################################################
@@ -678,6 +1418,11 @@ def uint16_to_hex(b: int) -> str:
     return f'0x{b:04X}'
 
 
+###############################################################################
+def uint32_to_hex(b: int) -> str:
+    return f'0x{b:08X}'
+
+
 ###############################################################################
 def create_triecode_array_c_string(
     symbol_map: Dict[str, int],
@@ -693,28 +1438,145 @@ def create_triecode_array_c_string(
 
 
 ###############################################################################
-def generate_sequence_transform_data(data_header_file, test_header_file):
-    symbol_map = generate_sequence_symbol_map(SEQ_TOKEN_SYMBOLS, WORDBREAK_SYMBOL)
-    output_func_symbol_map = generate_output_func_symbol_map(OUTPUT_FUNC_SYMBOLS)
+def fnv1a_32(data: bytes) -> int:
+    h = 2166136261
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xffffffff
+    return h
+
+
+###############################################################################
+def build_blob(stats: Dict[str, int], sections: Dict[str, bytes]) -> bytes:
+    """Returns the data sections with a header describing them."""
+    header_size = 16 + 2 * len(BLOB_STATS) + 8 * len(BLOB_SECTIONS)
+    header_size = (header_size + 3) & ~3
+    table = b''
+    payload = b''
+    for name in BLOB_SECTIONS:
+        data = sections[name]
+        table += struct.pack('<II', header_size + len(payload), len(data))
+        payload += data + bytes(-len(data) % 4)
+    stats_data = struct.pack(f'<{len(BLOB_STATS)}H', *(stats[name] for name in BLOB_STATS))
+    header = struct.pack('<4sHHII', BLOB_MAGIC, BLOB_FORMAT_VERSION, header_size,
+                         fnv1a_32(payload), header_size + len(payload))
+    header += stats_data + table
+    header += bytes(header_size - len(header))
+    return header + payload
+
+
+###############################################################################
+def content_hash(*parts: Any) -> str:
+    h = hashlib.sha256()
+    for part in parts:
+        h.update(part if isinstance(part, bytes) else str(part).encode('utf-8'))
+    return h.hexdigest()
+
 
-    seq_tranform_list = parse_file(RULES_FILE, symbol_map, SEP_STR, COMMENT_STR)
+###############################################################################
+def cached(cache_folder: Path, name: str, key: str, build: Callable[[], Any]) -> Any:
+    """Returns build(), or the value stored under `name` if it was built for `key`."""
+    cache_file = cache_folder / f'{name}.pickle' if cache_folder else None
+    if cache_file and cache_file.exists():
+        try:
+            with open(cache_file, 'rb') as file:
+                cached_key, value = pickle.load(file)
+            if cached_key == key:
+                return value
+        except (OSError, EOFError, ValueError, pickle.UnpicklingError):
+            pass
+
+    value = build()
+    if cache_file:
+        cache_folder.mkdir(exist_ok=True)
+        # a unique temp file, in case several generator runs store at once
+        with tempfile.NamedTemporaryFile(dir=cache_folder, prefix=f'{name}.', suffix='.tmp',
+                                         delete=False) as file:
+            pickle.dump((key, value), file)
+        os.replace(file.name, cache_file)
+    return value
+
+
+###############################################################################
+def write_if_changed(file_name: Path, data: bytes) -> bool:
+    """Writes `data` unless the file already holds it, to keep its timestamp."""
+    try:
+        if Path(file_name).read_bytes() == data:
+            return False
+    except OSError:
+        pass
+    with open(file_name, 'wb') as file:
+        file.write(data)
+    return True
+
+
+###############################################################################
+def build_outputs(
+    seq_tranform_list: List[Tuple[str, str]], symbol_map: Dict[str, int],
+    output_func_symbol_map: Dict[str, int], rules_hash: str
+) -> Tuple[List[str], bytes, bytes, bytes, Dict[str, Any]]:
+    """Returns the report lines, the data header, test header, blob and trie stats."""
+    report = []
     trie, outputs, missing_intermediate_rules, missing_prefix_rules = make_sequence_trie(seq_tranform_list, output_func_symbol_map)
 
     for missing_rule, affected_rules in missing_intermediate_rules.items():
-        print(f"Consider adding a rule for this sequence: {cyan(missing_rule)}\n  To fix these rules")
+        report.append(f"Consider adding a rule for this sequence: {cyan(missing_rule)}\n  To fix these rules")
         for rule in affected_rules:
-            print(f"    {cyan(missing_rule)}{yellow(rule[len(missing_rule):])}")
+            report.append(f"    {cyan(missing_rule)}{yellow(rule[len(missing_rule):])}")
 
     for cand_seq, missing_rules in missing_prefix_rules.items():
-        print(f"Missing potential rules starting with {cand_seq}")
+        report.append(f"Missing potential rules starting with {cand_seq}")
         for rule in missing_rules:
-            print(f"    {rule}")
+            report.append(f"    {rule}")
 
     s_outputs = serialize_outputs(outputs)
     completions_data, completions_map, max_completion_len = s_outputs
+    completions_huffman, code_counts, code_symbols, checkpoints = encode_completions(completions_data)
+    coded_completions_size = (
+        len(completions_huffman) + len(code_counts) + len(code_symbols) + 4 * len(checkpoints)
+    )
+    if completions_huffman:
+        report.append(
+            f'Completions: {len(completions_data)} bytes, {coded_completions_size} bytes entropy coded '
+            f'({cyan(len(completions_data) - coded_completions_size)} bytes saved with '
+            f'SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS)'
+        )
+    else:
+        report.append(
+            f'Completions: {len(completions_data)} bytes, {yellow("not entropy coded")} '
+            f'(codes would be longer than {COMPLETION_CODE_MAX_BITS} bits, '
+            f'SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS can\'t be used)'
+        )
 
-    trie_data = serialize_sequence_trie(symbol_map, trie, completions_map)
+    payload_data, payloads_map, payload_refs = build_payload_table(trie, completions_map)
+    index_size = payload_index_size(payloads_map, payload_refs)
+    table_index_size = 1 if len(payloads_map) <= 0x100 else 2
+    payload_bytes_saved = (TRIE_PAYLOAD_SIZE - table_index_size) * payload_refs - len(payload_data)
+    report.append(
+        f'Payloads: {payload_refs} matches, {len(payloads_map)} unique actions, '
+        f'{len(payload_data)} byte table with {table_index_size} byte index '
+        f'({cyan(payload_bytes_saved)} bytes saved, table {"used" if index_size else "not used"})'
+    )
+    if not index_size:
+        payload_data = []
+
+    layout = []
+    trie_data = serialize_sequence_trie(symbol_map, trie, completions_map, payloads_map, payload_refs, layout=layout)
+    stats = trie_stats(symbol_map, layout, len(trie_data), completions_map, len(completions_data))
+    stats['payload_table'] = {
+        'matches': payload_refs,
+        'unique_payloads': len(payloads_map),
+        'index_size': index_size,
+        'bytes_saved': payload_bytes_saved if index_size else 0,
+    }
     quiet_print(json.dumps(trie, indent=4))
+    aligned_trie_data = serialize_sequence_trie(symbol_map, trie, completions_map, payloads_map, payload_refs, aligned=True)
+
+    # padding in the aligned trie is skipped, so it reads the same bytes
+    # (tester -w checks the bounds against either layout)
+    stats['worst_case'] = worst_case_search(trie_data, index_size or TRIE_PAYLOAD_SIZE, search_alphabet(), WORST_CASE_CONTEXT_COUNT)
+
+    trigger_keys, trigger_pair_index, trigger_pair_rows = serialize_trigger_tables(symbol_map, trie)
+    max_multi_branch_depth = multi_branch_max_depth(symbol_map, trie)
 
     assert all(0 <= b <= 0xffff for b in trie_data)
     assert all(0 <= b <= 0xff for b in completions_data)
@@ -727,6 +1589,7 @@ def generate_sequence_transform_data(data_header_file, test_header_file):
     transforms = []
     test_rule_c_sequences = []
     test_rule_c_transforms = []
+    test_rules_data = []
 
     for sequence, transform in seq_tranform_list:
         # Don't add rules with transformation functions to test header for now
@@ -735,13 +1598,15 @@ def generate_sequence_transform_data(data_header_file, test_header_file):
             c_transform = create_triecode_array_c_string(symbol_map | TRANFORM_SYMBOL_MAP, transform)
             test_rule_c_sequences.append(c_sequence)
             test_rule_c_transforms.append(c_transform)
+            test_rules_data += [symbol_map[c] for c in sequence] + [0]
+            test_rules_data += [(symbol_map | TRANFORM_SYMBOL_MAP)[c] for c in transform] + [0]
         transform = transform.replace("\\", "\\ [escape]")
         sequence = f"{sequence:<{len(max_sequence)}}"
         transforms.append(f'//    {sequence} -> {transform}')
 
     header_lines = [
         GPL2_HEADER_C_LIKE,
-        GENERATED_HEADER_C_LIKE,
+        GENERATED_HEADER_C_LIKE.format(rules_hash=rules_hash[:16]),
         '#pragma once',
     ]
 
@@ -778,7 +1643,17 @@ def generate_sequence_transform_data(data_header_file, test_header_file):
         f'#define COMPLETION_MAX_LENGTH {max_completion_len}',
         f'#define MAX_BACKSPACES {max_backspaces}',
         f'#define SEQUENCE_TRIE_SIZE {len(trie_data)}',
+        f'#define SEQUENCE_TRIE_ALIGNED_SIZE {len(aligned_trie_data)}',
+        f'#define TRIE_PAYLOADS_SIZE {len(payload_data)}',
+        f'#define TRIE_PAYLOAD_INDEX_SIZE {index_size}',
         f'#define COMPLETIONS_SIZE {len(completions_data)}',
+        f'#define COMPLETIONS_HUFFMAN_SIZE {len(completions_huffman)}',
+        f'#define COMPLETION_CODE_MAX_LENGTH {len(code_counts)}',
+        f'#define COMPLETION_CODE_SYMBOL_COUNT {len(code_symbols)}',
+        f'#define COMPLETION_CHECKPOINT_INTERVAL {COMPLETION_CHECKPOINT_INTERVAL}',
+        f'#define COMPLETION_CHECKPOINT_COUNT {len(checkpoints)}',
+        f'#define TRIGGER_PAIR_ROWS_SIZE {len(trigger_pair_rows)}',
+        f'#define TRIE_MULTI_BRANCH_MAX_DEPTH {max_multi_branch_depth}',
         f'#define SEQUENCE_TOKEN_COUNT {len(SEQ_TOKEN_SYMBOLS)}',
         f'#define SEQUENCE_METACHAR_COUNT {len(SEQ_METACHAR_SYMBOLS)}',
         f'#define SEQUENCE_REF_TOKEN_COUNT {len(TRANSFORM_SEQUENCE_REFERENCE_SYMBOLS)}',
@@ -806,6 +1681,28 @@ def generate_sequence_transform_data(data_header_file, test_header_file):
         ),
         '};\n',
 
+        '// Same trie with 16bit values stored little-endian at even offsets',
+        'static const uint8_t '
+        'sequence_transform_trie_aligned[SEQUENCE_TRIE_ALIGNED_SIZE] PROGMEM __attribute__((aligned(2))) = {',
+
+        textwrap.fill(
+            '    %s' % (', '.join(map(byte_to_hex, aligned_trie_data))),
+            width=100, subsequent_indent='    '
+        ),
+        '};\n',
+
+        '// Unique match payloads, indexed by the matches in the trie',
+        '#if TRIE_PAYLOAD_INDEX_SIZE > 0',
+        'static const uint8_t '
+        'sequence_transform_payloads[TRIE_PAYLOADS_SIZE] PROGMEM = {',
+
+        textwrap.fill(
+            '    %s' % (', '.join(map(byte_to_hex, payload_data))),
+            width=100, subsequent_indent='    '
+        ),
+        '};',
+        '#endif\n',
+
         'static const uint8_t '
         'sequence_transform_completions_data[COMPLETIONS_SIZE] PROGMEM = {',
 
@@ -814,6 +1711,72 @@ def generate_sequence_transform_data(data_header_file, test_header_file):
             width=100, subsequent_indent='    '
         ),
         '};\n',
+
+        '// Same completions, canonical Huffman coded',
+        '#if COMPLETIONS_HUFFMAN_SIZE > 0',
+        'static const uint8_t '
+        'sequence_transform_completions_huffman[COMPLETIONS_HUFFMAN_SIZE] PROGMEM = {',
+
+        textwrap.fill(
+            '    %s' % (', '.join(map(byte_to_hex, completions_huffman))),
+            width=100, subsequent_indent='    '
+        ),
+        '};\n',
+
+        'static const uint8_t '
+        'sequence_transform_completion_code_counts[COMPLETION_CODE_MAX_LENGTH] PROGMEM = {',
+
+        textwrap.fill(
+            '    %s' % (', '.join(map(byte_to_hex, code_counts))),
+            width=100, subsequent_indent='    '
+        ),
+        '};\n',
+
+        'static const uint8_t '
+        'sequence_transform_completion_code_symbols[COMPLETION_CODE_SYMBOL_COUNT] PROGMEM = {',
+
+        textwrap.fill(
+            '    %s' % (', '.join(map(byte_to_hex, code_symbols))),
+            width=100, subsequent_indent='    '
+        ),
+        '};\n',
+
+        'static const uint32_t '
+        'sequence_transform_completion_checkpoints[COMPLETION_CHECKPOINT_COUNT] PROGMEM = {',
+
+        textwrap.fill(
+            '    %s' % (', '.join(map(uint32_to_hex, checkpoints))),
+            width=100, subsequent_indent='    '
+        ),
+        '};',
+        '#endif\n',
+
+        'static const uint8_t '
+        'sequence_transform_trigger_keys[32] PROGMEM = {',
+
+        textwrap.fill(
+            '    %s' % (', '.join(map(byte_to_hex, trigger_keys))),
+            width=100, subsequent_indent='    '
+        ),
+        '};\n',
+
+        'static const uint8_t '
+        'sequence_transform_trigger_pair_index[256] PROGMEM = {',
+
+        textwrap.fill(
+            '    %s' % (', '.join(map(byte_to_hex, trigger_pair_index))),
+            width=100, subsequent_indent='    '
+        ),
+        '};\n',
+
+        'static const uint8_t '
+        'sequence_transform_trigger_pair_rows[TRIGGER_PAIR_ROWS_SIZE] PROGMEM = {',
+
+        textwrap.fill(
+            '    %s' % (', '.join(map(byte_to_hex, trigger_pair_rows))),
+            width=100, subsequent_indent='    '
+        ),
+        '};\n',
     ]
 
     # Write data header file
@@ -826,8 +1789,7 @@ def generate_sequence_transform_data(data_header_file, test_header_file):
         '',
         *trie_data_lines,
     ]
-    with open(data_header_file, "w", encoding="utf-8") as file:
-        file.write("\n".join(sequence_transform_data_h_lines))
+    data_header = "\n".join(sequence_transform_data_h_lines).encode('utf-8')
 
     # Write test header file
     sequence_transform_test_h_lines = [
@@ -843,8 +1805,91 @@ def generate_sequence_transform_data(data_header_file, test_header_file):
         '    0',
         '};'
     ]
-    with open(test_header_file, "w", encoding="utf-8") as file:
-        file.write("\n".join(sequence_transform_test_h_lines))
+    test_header = "\n".join(sequence_transform_test_h_lines).encode('utf-8')
+
+    # Write binary blob
+    blob_stats = {
+        'SEQUENCE_MIN_LENGTH': len(min_sequence),
+        'SEQUENCE_MAX_LENGTH': len(max_sequence),
+        'TRANSFORM_MAX_LENGTH': len(max_transform),
+        'COMPLETION_MAX_LENGTH': max_completion_len,
+        'MAX_BACKSPACES': max_backspaces,
+        'COMPLETIONS_SIZE': len(completions_data),
+        'COMPLETION_CHECKPOINT_INTERVAL': COMPLETION_CHECKPOINT_INTERVAL,
+        'TRIECODE_SEQUENCE_TOKEN_0': TRIECODE_SEQUENCE_TOKEN_0,
+        'TRIECODE_SEQUENCE_METACHAR_0': TRIECODE_SEQUENCE_METACHAR_0,
+        'TRIECODE_SEQUENCE_REF_TOKEN_0': TRIECODE_TRANSFORM_SEQUENCE_REF_0,
+        'SEQUENCE_TOKEN_COUNT': len(SEQ_TOKEN_SYMBOLS),
+        'SEQUENCE_METACHAR_COUNT': len(SEQ_METACHAR_SYMBOLS),
+        'SEQUENCE_REF_TOKEN_COUNT': len(TRANSFORM_SEQUENCE_REFERENCE_SYMBOLS),
+        'TEST_RULE_COUNT': len(test_rule_c_sequences),
+        'MULTI_BRANCH_MAX_DEPTH': max_multi_branch_depth,
+        'PAYLOAD_INDEX_SIZE': index_size,
+    }
+    blob_sections = {
+        'trie': bytes(trie_data),
+        'trie_aligned': bytes(aligned_trie_data),
+        'payloads': bytes(payload_data),
+        'completions': bytes(completions_data),
+        'completions_huffman': bytes(completions_huffman),
+        'completion_code_counts': bytes(code_counts),
+        'completion_code_symbols': bytes(code_symbols),
+        'completion_checkpoints': struct.pack(f'<{len(checkpoints)}I', *checkpoints),
+        'trigger_keys': bytes(trigger_keys),
+        'trigger_pair_index': bytes(trigger_pair_index),
+        'trigger_pair_rows': bytes(trigger_pair_rows),
+        'seq_token_ascii_chars': ''.join(SEQ_TOKEN_ASCII_CHARS).encode('ascii'),
+        'seq_metachar_ascii_chars': ''.join(SEQ_METACHAR_ASCII_CHARS).encode('ascii'),
+        'test_rules': bytes(test_rules_data),
+    }
+    blob = build_blob(blob_stats, blob_sections)
+
+    return report, data_header, test_header, blob, stats
+
+
+###############################################################################
+def generate_sequence_transform_data(data_header_file, test_header_file, blob_file, cache_folder,
+                                     show_stats=False, stats_file=None,
+                                     worst_case_top=0, worst_case_file=None, max_flash_reads=None):
+    symbol_map = generate_sequence_symbol_map(SEQ_TOKEN_SYMBOLS, WORDBREAK_SYMBOL)
+    output_func_symbol_map = generate_output_func_symbol_map(OUTPUT_FUNC_SYMBOLS)
+
+    # Outputs depend only on the parsed rules, so edits to comments
+    # or formatting of the rules file reuse the generated data
+    rules_file_key = content_hash(GENERATOR_KEY, RULES_FILE.read_bytes())
+    seq_tranform_list, expansion_report, zones = cached(
+        cache_folder, 'rules', rules_file_key,
+        lambda: parse_file(RULES_FILE, symbol_map, SEP_STR, COMMENT_STR)
+    )
+    rules_hash = content_hash(GENERATOR_KEY, repr(seq_tranform_list))
+    report, data_header, test_header, blob, stats = cached(
+        cache_folder, 'outputs', rules_hash,
+        lambda: build_outputs(seq_tranform_list, symbol_map, output_func_symbol_map, rules_hash)
+    )
+    if expansion_report or report:
+        print("\n".join(expansion_report + report))
+
+    stats['regex_zones'] = regex_zone_stats(stats['rules'], zones)
+    if show_stats:
+        print("\n".join(format_stats(stats)))
+    if stats_file:
+        with open(stats_file, 'wt', encoding="utf-8") as file:
+            json.dump(stats, file, indent=4, ensure_ascii=False)
+    worst = stats['worst_case']
+    if worst_case_top:
+        print("\n".join(format_worst_case(worst, worst_case_top)))
+    if worst_case_file:
+        write_worst_case_contexts(worst_case_file, worst)
+    if max_flash_reads is not None and worst['max_flash_reads'] > max_flash_reads:
+        raise SystemExit(
+            f'{err()} A key can read {cyan(worst["max_flash_reads"])} bytes of trie data, '
+            f'more than max_search_flash_reads ({max_flash_reads}). '
+            f'Run with --worst-case 10 to see which contexts cost the most.'
+        )
+
+    outputs = [(data_header_file, data_header), (test_header_file, test_header), (blob_file, blob)]
+    written = [Path(f).name for f, data in outputs if write_if_changed(f, data)]
+    print(f"Updated {', '.join(written)}" if written else "Generated data is up to date")
 
 
 ###############################################################################
@@ -857,14 +1902,44 @@ if __name__ == '__main__':
     )
 
     parser.add_argument("-d", "--debug", action="store_true", default=False)
+    parser.add_argument(
+        "--no-cache", action="store_true", default=False,
+        help="ignore and don't update the cache of parsed rules and outputs"
+    )
+    parser.add_argument(
+        "--stats", action="store_true", default=False,
+        help="report the shape of the trie and the bytes and node visits each rule costs"
+    )
+    parser.add_argument(
+        "--stats-json", type=str, metavar="FILE",
+        help="write the --stats report, with every rule, to FILE as JSON"
+    )
+    parser.add_argument(
+        "--worst-case", type=int, metavar="N", default=0,
+        help=f"report upper bounds on the trie search work for one key, and the N (up to "
+             f"{WORST_CASE_CONTEXT_COUNT}) costliest key contexts"
+    )
+    parser.add_argument(
+        "--worst-case-file", type=str, metavar="FILE",
+        help="write the costliest key contexts to FILE, for tester -w FILE"
+    )
+    parser.add_argument(
+        "--max-flash-reads", type=int, metavar="BYTES",
+        help="fail if a key can read more than BYTES of trie data "
+             "(overrides max_search_flash_reads in the config)"
+    )
     cli_args = parser.parse_args()
 
     THIS_FOLDER = Path(__file__).parent
 
     data_header_file = THIS_FOLDER / "../sequence_transform_data.h"
     test_header_file = THIS_FOLDER / "../sequence_transform_test.h"
+    blob_file = THIS_FOLDER / "../sequence_transform_data.bin"
+    # debug output is printed while building, so -d doesn't use cached outputs
+    cache_folder = None if cli_args.no_cache or cli_args.debug else THIS_FOLDER / ".cache"
     config_file = THIS_FOLDER / cli_args.config
     config = json.load(open(config_file, 'rt', encoding="utf-8"))
+    GENERATOR_KEY = content_hash(Path(__file__).read_bytes(), json.dumps(config, sort_keys=True))
 
     try:
         SEQ_TOKEN_SYMBOLS = list(config['sequence_token_symbols'].keys())
@@ -886,6 +1961,11 @@ if __name__ == '__main__':
         raise SystemExit(f"Incorrect config! {cyan(*e.args)} key is missing.")
 
     IMPLICIT_TRANSFORM_LEADING_WORDBREAK = config.get('implicit_transform_leading_wordbreak', False)
+    MAX_FLASH_READS = cli_args.max_flash_reads if cli_args.max_flash_reads is not None \
+        else config.get('max_search_flash_reads')
+    # true or false to always or never deduplicate match payloads,
+    # otherwise only when it makes the trie smaller
+    PAYLOAD_TABLE = config.get('payload_table', 'auto')
     SEQ_TOKEN_ASCII_CHARS = list(config['sequence_token_symbols'].values())
     WORDBREAK_ASCII = config['wordbreak_symbol'][WORDBREAK_SYMBOL]
     DIGIT_ASCII = config['digit_symbol'][DIGIT_SYMBOL]
@@ -900,4 +1980,6 @@ if __name__ == '__main__':
     TRANFORM_SYMBOL_MAP = generate_transform_symbol_map()
 
     IS_QUIET = not cli_args.debug
-    generate_sequence_transform_data(data_header_file, test_header_file)
+    generate_sequence_transform_data(data_header_file, test_header_file, blob_file, cache_folder,
+                                     cli_args.stats, cli_args.stats_json,
+                                     cli_args.worst_case, cli_args.worst_case_file, MAX_FLASH_READS)
@@ -0,0 +1,78 @@
+// Copyright 2024 Guillaume Stordeur <guillaume.stordeur@gmail.com>
+// Copyright 2024 Matt Skalecki <ikcelaks@gmail.com>
+// Copyright 2024 QKekos <q.kekos.q@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "st_host.h"
+
+#define BENCH_EDIT_CAPACITY 1024
+#define BENCH_TEXT_CAPACITY 16384
+
+//////////////////////////////////////////////////////////////////
+// Feeds a text file through libsequence_transform in batches
+// and reports the throughput in events/s
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        printf("Usage: %s <text file> [repeats] [rules blob]\n", argv[0]);
+        return 1;
+    }
+    FILE *file = fopen(argv[1], "rb");
+    if (!file) {
+        printf("Unable to open %s\n", argv[1]);
+        return 1;
+    }
+    const int repeats = argc > 2 ? atoi(argv[2]) : 10;
+    if (argc > 3) {
+        const char *error = st_host_load(argv[3]);
+        if (error) {
+            printf("Unable to load %s: %s\n", argv[3], error);
+            return 1;
+        }
+    }
+    fseek(file, 0, SEEK_END);
+    const long size = ftell(file);
+    rewind(file);
+    uint8_t *events = malloc(size);
+    const long count = fread(events, 1, size, file);
+    fclose(file);
+    for (long i = 0; i < count; ++i) {
+        if (events[i] == '\n' || events[i] == '\r' || events[i] == '\t') {
+            events[i] = ' ';
+        } else if (events[i] >= 0x80) {
+            // not sequence tokens in a text file; reset like the tester does
+            events[i] = 0;
+        }
+    }
+    int completions_size = 0;
+    const char *completions = st_host_completions(&completions_size);
+    static st_host_edit_t edits[BENCH_EDIT_CAPACITY];
+    static char text[BENCH_TEXT_CAPACITY];
+    st_host_batch_t batch = { edits, BENCH_EDIT_CAPACITY, 0, text, BENCH_TEXT_CAPACITY, 0 };
+    long edit_count = 0, spans = 0, batches = 0;
+    const clock_t start = clock();
+    for (int rep = 0; rep < repeats; ++rep) {
+        st_host_reset();
+        for (long i = 0; i < count; ++batches) {
+            i += st_host_process(events + i, count - i, &batch);
+            edit_count += batch.edit_count;
+            for (int e = 0; e < batch.edit_count; ++e) {
+                const char *t = edits[e].text;
+                if (completions && t >= completions && t < completions + completions_size) {
+                    ++spans;
+                }
+            }
+        }
+    }
+    const double elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+    const long total = count * repeats;
+    printf("Events: %ld (%ld x %d)\n", total, count, repeats);
+    printf("Batches: %ld\n", batches);
+    printf("Edits: %ld (%ld point into the completions)\n", edit_count / repeats, spans / repeats);
+    printf("Time: %.3fs (%.0f events/s)\n", elapsed, elapsed > 0 ? total / elapsed : 0.0);
+    free(events);
+    return 0;
+}
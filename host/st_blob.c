@@ -0,0 +1,423 @@
+// Copyright 2024 Guillaume Stordeur <guillaume.stordeur@gmail.com>
+// Copyright 2024 Matt Skalecki <ikcelaks@gmail.com>
+// Copyright 2024 QKekos <q.kekos.q@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#ifndef WIN32
+#   include <fcntl.h>
+#   include <unistd.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#endif
+#include "st_defaults.h"
+#include "qmk_wrapper.h"
+#include "sequence_transform.h"
+#include "sequence_transform_data.h"
+#include "st_blob.h"
+
+#define BLOB_HEADER_FIXED_SIZE  16
+#define FNV_OFFSET_BASIS        2166136261UL
+#define FNV_PRIME               16777619UL
+
+//////////////////////////////////////////////////////////////////
+static uint32_t read_u16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+static uint32_t read_u32(const uint8_t *p) { return read_u16(p) | (read_u16(p + 2) << 16); }
+
+//////////////////////////////////////////////////////////////////
+#ifdef WIN32
+// No mmap here, so the file is read into memory instead
+static const uint8_t *map_file(const char *path, long *size)
+{
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        return 0;
+    }
+    fseek(file, 0, SEEK_END);
+    *size = ftell(file);
+    rewind(file);
+    uint8_t *data = malloc(*size);
+    if (data && fread(data, 1, *size, file) != (size_t)*size) {
+        free(data);
+        data = 0;
+    }
+    fclose(file);
+    return data;
+}
+static void unmap_file(const uint8_t *data, long size)
+{
+    free((void *)data);
+}
+#else
+static const uint8_t *map_file(const char *path, long *size)
+{
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return 0;
+    }
+    struct stat st;
+    void *data = MAP_FAILED;
+    if (!fstat(fd, &st) && st.st_size > 0) {
+        *size = st.st_size;
+        data = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    return data == MAP_FAILED ? 0 : data;
+}
+static void unmap_file(const uint8_t *data, long size)
+{
+    munmap((void *)data, size);
+}
+#endif
+//////////////////////////////////////////////////////////////////
+// Checks that the blob uses the triecodes compiled into this build
+static const char *check_compiled_config(const st_blob_t *blob)
+{
+    const int expected[][2] = {
+        { ST_BLOB_COMPLETION_CHECKPOINT_INTERVAL,   COMPLETION_CHECKPOINT_INTERVAL },
+        { ST_BLOB_TRIECODE_SEQUENCE_TOKEN_0,        TRIECODE_SEQUENCE_TOKEN_0 },
+        { ST_BLOB_TRIECODE_SEQUENCE_METACHAR_0,     TRIECODE_SEQUENCE_METACHAR_0 },
+        { ST_BLOB_TRIECODE_SEQUENCE_REF_TOKEN_0,    TRIECODE_SEQUENCE_REF_TOKEN_0 },
+        { ST_BLOB_SEQUENCE_TOKEN_COUNT,             SEQUENCE_TOKEN_COUNT },
+        { ST_BLOB_SEQUENCE_METACHAR_COUNT,          SEQUENCE_METACHAR_COUNT },
+        { ST_BLOB_SEQUENCE_REF_TOKEN_COUNT,         SEQUENCE_REF_TOKEN_COUNT },
+    };
+    for (int i = 0; i < (int)(sizeof(expected) / sizeof(expected[0])); ++i) {
+        if (blob->stats[expected[i][0]] != expected[i][1]) {
+            return "token ranges differ from the compiled in config";
+        }
+    }
+    if (blob->section_sizes[ST_BLOB_SEQ_TOKEN_ASCII_CHARS] != SEQUENCE_TOKEN_COUNT
+            || memcmp(blob->sections[ST_BLOB_SEQ_TOKEN_ASCII_CHARS], st_seq_token_ascii_chars, SEQUENCE_TOKEN_COUNT)
+            || blob->section_sizes[ST_BLOB_SEQ_METACHAR_ASCII_CHARS] != SEQUENCE_METACHAR_COUNT
+            || memcmp(blob->sections[ST_BLOB_SEQ_METACHAR_ASCII_CHARS], st_seq_metachar_ascii_chars, SEQUENCE_METACHAR_COUNT)) {
+        return "token ascii chars differ from the compiled in config";
+    }
+    if (blob->stats[ST_BLOB_COMPLETION_MAX_LENGTH] > 255
+            || blob->section_sizes[ST_BLOB_TRIGGER_KEYS] != 32
+            || blob->section_sizes[ST_BLOB_TRIGGER_PAIR_INDEX] != 256
+            || blob->section_sizes[ST_BLOB_PAYLOADS] % TRIE_PAYLOAD_SIZE
+            || blob->stats[ST_BLOB_PAYLOAD_INDEX_SIZE] > 2) {
+        return "unsupported table sizes";
+    }
+#if SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS
+    if (!blob->section_sizes[ST_BLOB_COMPLETIONS_HUFFMAN] && blob->section_sizes[ST_BLOB_COMPLETIONS]) {
+        return "completions aren't entropy coded (codes too long)";
+    }
+#endif
+    return 0;
+}
+//////////////////////////////////////////////////////////////////
+// Points the trie at the sections used by this build
+static void init_trie(st_blob_t *blob)
+{
+    st_trie_t *trie = &blob->trie;
+    memset(trie, 0, sizeof(*trie));
+#if SEQUENCE_TRANSFORM_TRIE_ALIGNED
+    trie->data_size = blob->section_sizes[ST_BLOB_TRIE_ALIGNED];
+    trie->data = blob->sections[ST_BLOB_TRIE_ALIGNED];
+#else
+    trie->data_size = blob->section_sizes[ST_BLOB_TRIE];
+    trie->data = blob->sections[ST_BLOB_TRIE];
+#endif
+    trie->payloads_size = blob->section_sizes[ST_BLOB_PAYLOADS];
+    trie->payloads = blob->sections[ST_BLOB_PAYLOADS];
+    trie->payload_index_size = blob->stats[ST_BLOB_PAYLOAD_INDEX_SIZE];
+#if SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS
+    trie->completions_size = blob->section_sizes[ST_BLOB_COMPLETIONS_HUFFMAN];
+    trie->completions = blob->sections[ST_BLOB_COMPLETIONS_HUFFMAN];
+    trie->completion_code_counts = blob->sections[ST_BLOB_COMPLETION_CODE_COUNTS];
+    trie->completion_code_max_len = blob->section_sizes[ST_BLOB_COMPLETION_CODE_COUNTS];
+    trie->completion_code_symbols = blob->sections[ST_BLOB_COMPLETION_CODE_SYMBOLS];
+    // little-endian in the file, which is what the host reads
+    trie->completion_checkpoints = (const uint32_t *)blob->sections[ST_BLOB_COMPLETION_CHECKPOINTS];
+    trie->completion_checkpoint_count = blob->section_sizes[ST_BLOB_COMPLETION_CHECKPOINTS] / 4;
+#else
+    trie->completions_size = blob->section_sizes[ST_BLOB_COMPLETIONS];
+    trie->completions = blob->sections[ST_BLOB_COMPLETIONS];
+#endif
+    trie->sequence_max_len = blob->stats[ST_BLOB_SEQUENCE_MAX_LENGTH];
+    trie->completion_max_len = blob->stats[ST_BLOB_COMPLETION_MAX_LENGTH];
+    trie->max_backspaces = blob->stats[ST_BLOB_MAX_BACKSPACES];
+#if SEQUENCE_TRANSFORM_TRIGGER_FILTER
+    trie->trigger_keys = blob->sections[ST_BLOB_TRIGGER_KEYS];
+#endif
+#if SEQUENCE_TRANSFORM_TRIGGER_PAIR_FILTER
+    trie->trigger_pair_index = blob->sections[ST_BLOB_TRIGGER_PAIR_INDEX];
+    trie->trigger_pair_rows = blob->sections[ST_BLOB_TRIGGER_PAIR_ROWS];
+#endif
+}
+//////////////////////////////////////////////////////////////////
+// Maps the blob at `path` and checks it.
+// Returns an error message, or 0 on success.
+const char *st_blob_open(st_blob_t *blob, const char *path)
+{
+    memset(blob, 0, sizeof(*blob));
+    blob->data = map_file(path, &blob->size);
+    if (!blob->data) {
+        return "unable to open file";
+    }
+    const uint8_t *data = blob->data;
+    const char *error = 0;
+    const uint32_t header_size = blob->size >= BLOB_HEADER_FIXED_SIZE ? read_u16(data + 6) : 0;
+    if (blob->size < BLOB_HEADER_FIXED_SIZE || memcmp(data, ST_BLOB_MAGIC, 4)) {
+        error = "not a sequence transform blob";
+    } else if (read_u16(data + 4) != ST_BLOB_FORMAT_VERSION) {
+        error = "unsupported blob format version";
+    } else if (read_u32(data + 12) != blob->size
+            || header_size < BLOB_HEADER_FIXED_SIZE + 2 * ST_BLOB_STAT_COUNT + 8 * ST_BLOB_SECTION_COUNT
+            || header_size > blob->size) {
+        error = "truncated blob";
+    }
+    if (!error) {
+        uint32_t hash = FNV_OFFSET_BASIS;
+        for (long i = header_size; i < blob->size; ++i) {
+            hash = (hash ^ data[i]) * FNV_PRIME;
+        }
+        if (hash != read_u32(data + 8)) {
+            error = "checksum mismatch";
+        }
+    }
+    if (!error) {
+        const uint8_t *p = data + BLOB_HEADER_FIXED_SIZE;
+        for (int i = 0; i < ST_BLOB_STAT_COUNT; ++i, p += 2) {
+            blob->stats[i] = read_u16(p);
+        }
+        for (int i = 0; i < ST_BLOB_SECTION_COUNT; ++i, p += 8) {
+            const uint32_t offset = read_u32(p);
+            const uint32_t size = read_u32(p + 4);
+            if (offset < header_size || offset > blob->size || size > blob->size - offset) {
+                error = "section out of bounds";
+                break;
+            }
+            blob->sections[i] = data + offset;
+            blob->section_sizes[i] = size;
+        }
+    }
+    if (!error) {
+        error = check_compiled_config(blob);
+    }
+    if (error) {
+        st_blob_close(blob);
+        return error;
+    }
+    init_trie(blob);
+    return 0;
+}
+//////////////////////////////////////////////////////////////////
+void st_blob_close(st_blob_t *blob)
+{
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+    st_blob_detach_storage(blob);
+#endif
+    if (blob->data) {
+        unmap_file(blob->data, blob->size);
+    }
+    memset(blob, 0, sizeof(*blob));
+}
+//////////////////////////////////////////////////////////////////
+// Creates an engine for the blob's trie, with buffers sized
+// for it like the static ones in sequence_transform.c.
+// The blob must stay open while the engine is used.
+// returns 0 if the engine couldn't be allocated
+st_engine_t *st_blob_create_engine(const st_blob_t *blob)
+{
+    const int seq_max = blob->stats[ST_BLOB_SEQUENCE_MAX_LENGTH];
+    const int completion_max = blob->stats[ST_BLOB_COMPLETION_MAX_LENGTH];
+    const int key_buffer_capacity = MIN(255, seq_max + completion_max + SEQUENCE_TRANSFORM_EXTRA_BUFFER);
+    const int stack_size = MAX(seq_max, blob->stats[ST_BLOB_MAX_BACKSPACES] + blob->stats[ST_BLOB_TRANSFORM_MAX_LENGTH]);
+    st_engine_t *engine = malloc(sizeof(st_engine_t));
+    if (!engine) {
+        return 0;
+    }
+    st_key_action_t *key_buffer_data = calloc(key_buffer_capacity, sizeof(st_key_action_t));
+    uint8_t *seq_ref_cache = calloc(key_buffer_capacity * 2, 1);
+    uint8_t *stack_data = calloc(stack_size, 1);
+#if SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS
+    uint8_t *cursor_completion = calloc(MAX(completion_max, 1), 1);
+#endif
+    const int branch_stack_size = MAX(blob->stats[ST_BLOB_MULTI_BRANCH_MAX_DEPTH], 1);
+    st_trie_branch_t *branch_stack = calloc(branch_stack_size, sizeof(st_trie_branch_t));
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+    uint32_t *no_match_cache_tags = calloc(SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE, sizeof(uint32_t));
+    uint8_t *no_match_cache_tails = calloc(SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE * (seq_max + 1), 1);
+#endif
+#if SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE > 0
+    const int undo_max_restore = blob->stats[ST_BLOB_MAX_BACKSPACES] + 1;
+    st_undo_entry_t *undo_journal_entries = calloc(SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE, sizeof(st_undo_entry_t));
+    uint8_t *undo_journal_text = calloc(SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE * undo_max_restore, 1);
+    uint8_t *undo_journal_output = calloc(undo_max_restore, 1);
+#endif
+    // const members can only be set by an initializer
+    const st_engine_t init = {
+        &blob->trie,
+        {
+            key_buffer_data,
+            key_buffer_capacity,
+            0,
+            0,
+            seq_ref_cache,
+            key_buffer_capacity * 2,
+            0,
+            0,
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+            0
+#endif
+        },
+        {
+            stack_data,
+            stack_size,
+            0
+        },
+        {
+            &engine->key_buffer,
+            &blob->trie,
+            {0, 255, 0, false},
+            {0},
+#if SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS
+            cursor_completion,
+#endif
+            false,
+            0,
+            branch_stack,
+            branch_stack_size,
+            {0},
+#ifdef ST_TESTER
+            0,
+            false,
+#endif
+        },
+        0,
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+        {
+            no_match_cache_tags,
+            no_match_cache_tails,
+            SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE,
+            seq_max + 1,
+            0,
+#ifdef ST_TESTER
+            false,
+            0,
+            0,
+#endif
+        },
+#endif
+#if SEQUENCE_TRANSFORM_IDLE_TIMEOUT > 0
+        0,
+#endif
+#if SEQUENCE_TRANSFORM_ENHANCED_BACKSPACE
+        0,
+        false,
+#endif
+#if SEQUENCE_TRANSFORM_BACKSPACE_REPEAT > 0
+        false,
+        false,
+#endif
+#if SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE > 0
+        {
+            undo_journal_entries,
+            undo_journal_text,
+            undo_journal_output,
+            SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE,
+            undo_max_restore,
+            0,
+            0,
+            0,
+            0
+        },
+#endif
+#if SEQUENCE_TRANSFORM_RULE_SEARCH
+        false,
+#endif
+    };
+    memcpy(engine, &init, sizeof(init));
+    bool allocated = key_buffer_data && seq_ref_cache && stack_data && branch_stack;
+#if SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS
+    allocated = allocated && cursor_completion;
+#endif
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+    allocated = allocated && no_match_cache_tags && no_match_cache_tails;
+#endif
+#if SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE > 0
+    allocated = allocated && undo_journal_entries && undo_journal_text && undo_journal_output;
+#endif
+    if (!allocated) {
+        // frees the buffers that were allocated
+        st_blob_destroy_engine(engine);
+        return 0;
+    }
+    st_engine_reset(engine);
+    return engine;
+}
+//////////////////////////////////////////////////////////////////
+void st_blob_destroy_engine(st_engine_t *engine)
+{
+    free(engine->key_buffer.data);
+    free(engine->key_buffer.seq_ref_cache);
+    free(engine->trie_stack.buffer);
+#if SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS
+    free(engine->trie_cursor.cached_completion);
+#endif
+    free(engine->trie_cursor.branch_stack);
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+    free(engine->no_match_cache.tags);
+    free(engine->no_match_cache.tails);
+#endif
+#if SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE > 0
+    free(engine->undo_journal.entries);
+    free(engine->undo_journal.text);
+    free(engine->undo_journal.output);
+#endif
+    free(engine);
+}
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+//////////////////////////////////////////////////////////////////
+// Device driver reading pages from the blob file
+static bool read_device(void *context, uint32_t address, uint8_t *dest, int size)
+{
+    st_blob_t *blob = context;
+    const clock_t start = clock();
+    // the last page may run past the end of the file
+    memset(dest, 0, size);
+    const bool ok = !fseek(blob->device, address, SEEK_SET) && (fread(dest, 1, size, blob->device) > 0);
+    blob->device_seconds += (double)(clock() - start) / CLOCKS_PER_SEC;
+    ++blob->device_reads;
+    return ok;
+}
+//////////////////////////////////////////////////////////////////
+// Reads the trie and completions of the open blob through `storage`
+// from the file at `path` (the blob's own file), like a keyboard reading
+// them from external flash. The mapped data stays available, so
+// setting trie.storage to 0 switches back to reading it directly.
+// Returns an error message, or 0 on success.
+const char *st_blob_attach_storage(st_blob_t *blob, st_storage_t *storage, const char *path)
+{
+    st_blob_detach_storage(blob);
+    blob->device = fopen(path, "rb");
+    if (!blob->device) {
+        return "unable to open file";
+    }
+    blob->device_reads = 0;
+    blob->device_seconds = 0;
+    st_storage_init(storage, read_device, blob);
+    blob->trie.storage = storage;
+    // sections live at the same offsets on the device as in the file
+    blob->trie.data_address = blob->trie.data - blob->data;
+    blob->trie.completions_address = blob->trie.completions - blob->data;
+    blob->trie.payloads_address = blob->trie.payloads - blob->data;
+    st_trie_pin_top_level(&blob->trie);
+    return 0;
+}
+//////////////////////////////////////////////////////////////////
+void st_blob_detach_storage(st_blob_t *blob)
+{
+    if (blob->device) {
+        fclose(blob->device);
+        blob->device = 0;
+    }
+    blob->trie.storage = 0;
+}
+#endif
@@ -0,0 +1,87 @@
+// Copyright 2024 Guillaume Stordeur <guillaume.stordeur@gmail.com>
+// Copyright 2024 Matt Skalecki <ikcelaks@gmail.com>
+// Copyright 2024 QKekos <q.kekos.q@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "st_defaults.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "sequence_transform.h"
+
+//////////////////////////////////////////////////////////////////
+// Dictionary data loaded at runtime from sequence_transform_data.bin
+// (written by the generator next to sequence_transform_data.h)
+//
+// The file is mapped read-only and the trie points straight into it,
+// so loading doesn't depend on the size of the dictionary.
+// Blobs must come from a generator with the same config as the
+// compiled in data (token ranges), but any rules file.
+
+#define ST_BLOB_MAGIC           "STBL"
+#define ST_BLOB_FORMAT_VERSION  4
+
+// Header stats, in file order (see BLOB_STATS in the generator)
+enum {
+    ST_BLOB_SEQUENCE_MIN_LENGTH,
+    ST_BLOB_SEQUENCE_MAX_LENGTH,
+    ST_BLOB_TRANSFORM_MAX_LENGTH,
+    ST_BLOB_COMPLETION_MAX_LENGTH,
+    ST_BLOB_MAX_BACKSPACES,
+    ST_BLOB_COMPLETIONS_SIZE,
+    ST_BLOB_COMPLETION_CHECKPOINT_INTERVAL,
+    ST_BLOB_TRIECODE_SEQUENCE_TOKEN_0,
+    ST_BLOB_TRIECODE_SEQUENCE_METACHAR_0,
+    ST_BLOB_TRIECODE_SEQUENCE_REF_TOKEN_0,
+    ST_BLOB_SEQUENCE_TOKEN_COUNT,
+    ST_BLOB_SEQUENCE_METACHAR_COUNT,
+    ST_BLOB_SEQUENCE_REF_TOKEN_COUNT,
+    ST_BLOB_TEST_RULE_COUNT,
+    ST_BLOB_MULTI_BRANCH_MAX_DEPTH,
+    ST_BLOB_PAYLOAD_INDEX_SIZE,
+    ST_BLOB_STAT_COUNT
+};
+
+// Data sections, in file order (see BLOB_SECTIONS in the generator)
+enum {
+    ST_BLOB_TRIE,
+    ST_BLOB_TRIE_ALIGNED,
+    ST_BLOB_PAYLOADS,
+    ST_BLOB_COMPLETIONS,
+    ST_BLOB_COMPLETIONS_HUFFMAN,
+    ST_BLOB_COMPLETION_CODE_COUNTS,
+    ST_BLOB_COMPLETION_CODE_SYMBOLS,
+    ST_BLOB_COMPLETION_CHECKPOINTS,
+    ST_BLOB_TRIGGER_KEYS,
+    ST_BLOB_TRIGGER_PAIR_INDEX,
+    ST_BLOB_TRIGGER_PAIR_ROWS,
+    ST_BLOB_SEQ_TOKEN_ASCII_CHARS,
+    ST_BLOB_SEQ_METACHAR_ASCII_CHARS,
+    ST_BLOB_TEST_RULES,
+    ST_BLOB_SECTION_COUNT
+};
+
+typedef struct st_blob_t
+{
+    const uint8_t   *data;                                  // mapped file
+    long            size;
+    uint16_t        stats[ST_BLOB_STAT_COUNT];
+    const uint8_t   *sections[ST_BLOB_SECTION_COUNT];
+    int             section_sizes[ST_BLOB_SECTION_COUNT];
+    st_trie_t       trie;                                   // points into the sections
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+    FILE            *device;                                // simulated block device
+    long            device_reads;                           // pages read from it
+    double          device_seconds;                         // time spent reading them
+#endif
+} st_blob_t;
+
+const char  *st_blob_open(st_blob_t *blob, const char *path);
+void        st_blob_close(st_blob_t *blob);
+st_engine_t *st_blob_create_engine(const st_blob_t *blob);
+void        st_blob_destroy_engine(st_engine_t *engine);
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+const char  *st_blob_attach_storage(st_blob_t *blob, st_storage_t *storage, const char *path);
+void        st_blob_detach_storage(st_blob_t *blob);
+#endif
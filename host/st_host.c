@@ -0,0 +1,206 @@
+// Copyright 2024 Guillaume Stordeur <guillaume.stordeur@gmail.com>
+// Copyright 2024 Matt Skalecki <ikcelaks@gmail.com>
+// Copyright 2024 QKekos <q.kekos.q@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+
+#include "st_defaults.h"
+#include "qmk_wrapper.h"
+#include "triecodes.h"
+#include "sequence_transform.h"
+#include "st_blob.h"
+#include "st_host.h"
+
+// Rules loaded with st_host_load
+static st_blob_t        host_blob = {0};
+static st_engine_t      *host_blob_engine = 0;
+
+//////////////////////////////////////////////////////////////////
+// The engine's output is collected into a feed batch while it
+// processes an event (see host_process_event), so nothing is
+// ever sent with this stand-in for the QMK function
+void tap_code16(uint16_t keycode)
+{
+}
+//////////////////////////////////////////////////////////////////
+// Edits are applied instead of their event, so fold in the effect
+// of an event that was typed before the engine sent more keys
+static void edit_fold_typed_event(st_host_batch_t *batch, st_host_edit_t *edit, uint8_t event)
+{
+    if (event == '\b') {
+        ++edit->backspaces;
+    } else if (edit->backspaces > 0) {
+        // the typed key is the first one deleted
+        --edit->backspaces;
+    } else {
+        char *text = batch->text + batch->text_size - edit->len;
+        memmove(text + 1, text, edit->len);
+        text[0] = event;
+        edit->text = text;
+        ++edit->len;
+        ++batch->text_size;
+    }
+}
+//////////////////////////////////////////////////////////////////
+// Points the edit of a performed rule at its completion,
+// instead of keeping a copy in the batch
+static void edit_use_completion_span(st_engine_t *engine, st_host_batch_t *batch, st_host_edit_t *edit)
+{
+#if !SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS
+    const st_key_action_t *key = st_key_buffer_get(&engine->key_buffer, 0);
+    if (!key || key->action_taken == ST_DEFAULT_KEY_ACTION) {
+        return;
+    }
+    st_trie_payload_t payload;
+    st_get_payload_from_match_index(engine->trie, &payload, key->action_taken);
+    const char *completion = (const char *)engine->trie->completions + payload.completion_index;
+    // completions with sequence references resolve to different text
+    if (edit->len == payload.completion_len && !memcmp(edit->text, completion, edit->len)) {
+        batch->text_size -= edit->len;
+        edit->text = completion;
+    }
+#endif
+}
+//////////////////////////////////////////////////////////////////
+// Drops the edit if it just types its own event
+static void edit_drop_noop(st_host_batch_t *batch, st_host_edit_t *edit, uint8_t event)
+{
+    if (edit->backspaces || edit->len != 1 || edit->text[0] != event) {
+        return;
+    }
+    if (edit->text == batch->text + batch->text_size - 1) {
+        --batch->text_size;
+    }
+    --batch->edit_count;
+}
+//////////////////////////////////////////////////////////////////
+static uint16_t event_to_keycode(uint8_t event)
+{
+    if (event == '\b') {
+        return KC_BSPC;
+    }
+    if (st_is_seq_token_triecode(event)) {
+        return TEST_KC_SEQ_TOKEN_0 + event - 0x80;
+    }
+    if (event >= ' ' && event < 0x7f) {
+        return st_ascii_to_keycode(event);
+    }
+    return KC_NO;
+}
+//////////////////////////////////////////////////////////////////
+// Press and release the key, as QMK would, and add the keys
+// the engine sent to the batch as the event's edit
+static void host_process_event(st_engine_t *engine, st_host_batch_t *batch, uint32_t index, uint8_t event)
+{
+    const uint16_t keycode = event_to_keycode(event);
+    // the engine's output goes straight to the end of the batch text
+    st_feed_batch_t output = {{(uint8_t *)batch->text + batch->text_size,
+                               batch->text_capacity - batch->text_size, 0}, 0, 0};
+    engine->feed_batch = &output;
+    keyrecord_t record;
+    memset(&record, 0, sizeof(record));
+    record.event.pressed = true;
+    const bool typed = st_engine_process(engine, keycode, &record, TEST_KC_SEQ_TOKEN_0);
+    st_engine_post_process(engine);
+    record.event.pressed = false;
+    st_engine_process(engine, keycode, &record, TEST_KC_SEQ_TOKEN_0);
+    st_engine_post_process(engine);
+    engine->feed_batch = 0;
+    if (typed && !output.output.size && !output.backspaces) {
+        return;
+    }
+    st_host_edit_t *edit = &batch->edits[batch->edit_count++];
+    edit->event = index;
+    edit->backspaces = output.backspaces;
+    edit->text = batch->text + batch->text_size;
+    edit->len = 0;
+    for (int i = 0; i < output.output.size; ++i) {
+        const uint8_t triecode = output.output.buffer[i];
+        // sequence tokens don't type anything by themselves
+        if (st_is_seq_token_triecode(triecode)) {
+            continue;
+        }
+        char c = triecode;
+        // the engine strips shift from alphas, which QMK would still be holding
+        if (event >= 'A' && event <= 'Z' && c >= 'a' && c <= 'z') {
+            c += 'A' - 'a';
+        }
+        batch->text[batch->text_size++] = c;
+        ++edit->len;
+    }
+    if (typed) {
+        edit_fold_typed_event(batch, edit, event);
+    } else {
+        edit_use_completion_span(engine, batch, edit);
+    }
+    edit_drop_noop(batch, edit, event);
+}
+//////////////////////////////////////////////////////////////////
+// Most text a single event can add to a batch
+int st_host_max_event_text(void)
+{
+    const st_trie_t *trie = st_get_engine()->trie;
+    return trie->completion_max_len + trie->max_backspaces + 1;
+}
+//////////////////////////////////////////////////////////////////
+// Processes events until they are all done or the batch is full.
+// Returns the number of events processed. The batch is cleared first.
+int st_host_process(const uint8_t *events, int count, st_host_batch_t *batch)
+{
+    st_engine_t *engine = st_get_engine();
+    const int max_event_text = st_host_max_event_text();
+    batch->edit_count = 0;
+    batch->text_size = 0;
+    int i = 0;
+    for (; i < count; ++i) {
+        if (batch->edit_count == batch->edit_capacity ||
+            batch->text_size + max_event_text > batch->text_capacity) {
+            break;
+        }
+        host_process_event(engine, batch, i, events[i]);
+    }
+    return i;
+}
+//////////////////////////////////////////////////////////////////
+void st_host_reset(void)
+{
+    st_engine_reset(st_get_engine());
+}
+//////////////////////////////////////////////////////////////////
+// Text that edits can point into (null if completions are compressed)
+const char *st_host_completions(int *size)
+{
+#if SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS
+    *size = 0;
+    return 0;
+#else
+    const st_trie_t *trie = st_get_engine()->trie;
+    *size = trie->completions_size;
+    return (const char *)trie->completions;
+#endif
+}
+//////////////////////////////////////////////////////////////////
+const char *st_host_load(const char *path)
+{
+    st_blob_t blob;
+    const char *error = path ? st_blob_open(&blob, path) : 0;
+    if (error) {
+        return error;
+    }
+    st_set_engine(0);
+    if (host_blob_engine) {
+        st_blob_destroy_engine(host_blob_engine);
+        st_blob_close(&host_blob);
+        host_blob_engine = 0;
+    }
+    if (path) {
+        // the engine's trie points into host_blob, so create it from there
+        host_blob = blob;
+        host_blob_engine = st_blob_create_engine(&host_blob);
+        if (!host_blob_engine) {
+            st_blob_close(&host_blob);
+            return "unable to allocate the engine";
+        }
+        st_set_engine(host_blob_engine);
+    }
+    return 0;
+}
@@ -0,0 +1,49 @@
+// Copyright 2024 Guillaume Stordeur <guillaume.stordeur@gmail.com>
+// Copyright 2024 Matt Skalecki <ikcelaks@gmail.com>
+// Copyright 2024 QKekos <q.kekos.q@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//////////////////////////////////////////////////////////////////
+// Public API of libsequence_transform
+//
+// Key events are bytes:
+//   0x20-0x7E  printable ascii keys
+//   '\b'       backspace (undoes the last action if enhanced backspace is on)
+//   0x80+n     sequence token key n (same as its triecode)
+//   anything else resets the key buffer, like a non-processable QMK key
+//
+// An event with an edit must not be typed. The edit is applied instead:
+// delete `backspaces` characters, then type the `len` characters at `text`.
+// Events without an edit are typed as usual.
+
+typedef struct
+{
+    uint32_t        event;          // index of the event this edit replaces
+    uint16_t        backspaces;     // characters to delete before inserting text
+    uint16_t        len;            // number of characters to insert
+    const char      *text;          // points into st_host_completions() when possible,
+                                    // otherwise into the batch text
+} st_host_edit_t;
+
+typedef struct
+{
+    st_host_edit_t  *edits;         // caller provided storage for edits
+    int             edit_capacity;
+    int             edit_count;
+    char            *text;          // caller provided storage for text that isn't a completion span
+    int             text_capacity;
+    int             text_size;
+} st_host_batch_t;
+
+int         st_host_process(const uint8_t *events, int count, st_host_batch_t *batch);
+void        st_host_reset(void);
+const char  *st_host_completions(int *size);
+int         st_host_max_event_text(void);
+// Switches to the rules in a sequence_transform_data.bin file
+// (null path goes back to the compiled in rules).
+// Returns an error message, or null on success.
+const char  *st_host_load(const char *path);
@@ -60,6 +60,9 @@ void st_key_buffer_reset(st_key_buffer_t *buf)
 {
     buf->size = 0;
     buf->seq_ref_size = 0;
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+    buf->action_base = 0;
+#endif
     st_key_buffer_push(buf, ' ');
 }
 //////////////////////////////////////////////////////////////////
@@ -72,11 +75,47 @@ void st_key_buffer_push(st_key_buffer_t *buf, uint8_t triecode)
     if (++buf->head >= buf->capacity) {  // increment cur_pos
         buf->head = 0;               // wrap to 0
     }
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+    if (buf->size == buf->capacity) {
+        // the oldest key is overwritten
+        buf->action_base = buf->data[buf->head].action_count;
+    }
+#endif
     buf->data[buf->head].triecode = tolower(triecode);
     buf->data[buf->head].action_taken = ST_DEFAULT_KEY_ACTION;
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+    // Running totals, so the no-match cache can get them
+    // for a window of recent keys without rescanning it
+    const st_key_action_t *prev = st_key_buffer_get(buf, 1);
+    buf->data[buf->head].context_hash = (prev ? prev->context_hash * ST_CONTEXT_HASH_MULT : 0)
+                                        + buf->data[buf->head].triecode;
+    buf->data[buf->head].action_count = prev ? prev->action_count : 0;
+#endif
     st_key_buffer_push_seq_ref(buf, '\0');
 }
 //////////////////////////////////////////////////////////////////
+// Records the action performed by the most recent key
+void st_key_buffer_set_action(st_key_buffer_t *buf, uint16_t action)
+{
+    st_key_action_t *keyaction = st_key_buffer_get(buf, 0);
+    keyaction->action_taken = action;
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+    const st_key_action_t *prev = st_key_buffer_get(buf, 1);
+    keyaction->action_count = (prev ? prev->action_count : 0)
+                              + (action != ST_DEFAULT_KEY_ACTION);
+#endif
+}
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+//////////////////////////////////////////////////////////////////
+// returns the number of keys from `index` to the oldest one
+// that performed an action, in O(1)
+int st_key_buffer_count_actions(const st_key_buffer_t *buf, int index)
+{
+    const st_key_action_t *keyaction = st_key_buffer_get(buf, index);
+    return keyaction ? (uint8_t)(keyaction->action_count - buf->action_base) : 0;
+}
+#endif
+//////////////////////////////////////////////////////////////////
 void st_key_buffer_pop(st_key_buffer_t *buf)
 {
     if (buf->size <= 1) {
@@ -8,12 +8,17 @@
 // Public API
 
 #define ST_DEFAULT_KEY_ACTION 0xffff
+#define ST_CONTEXT_HASH_MULT 16777619UL
 
 typedef struct
 {
     uint8_t triecode;
     uint8_t is_anchor_match;
     uint16_t action_taken;
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+    uint32_t context_hash;  // polynomial hash of the keys up to this one since the last reset
+    uint8_t  action_count;  // keys up to this one that performed an action (mod 256)
+#endif
 } st_key_action_t;
 
 typedef struct
@@ -26,6 +31,9 @@ typedef struct
     const int               seq_ref_capacity;
     int                     seq_ref_size;
     int                     seq_ref_head;
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+    uint8_t                 action_base;    // action_count of the key dropped before the oldest one
+#endif
 } st_key_buffer_t;
 
 st_key_action_t *st_key_buffer_get(const st_key_buffer_t *buf, int index);
@@ -33,6 +41,10 @@ uint8_t         st_key_buffer_get_triecode(const st_key_buffer_t *buf, int index
 void            st_key_buffer_reset(st_key_buffer_t *buf);
 void            st_key_buffer_push(st_key_buffer_t *buf, uint8_t triecode);
 void            st_key_buffer_pop(st_key_buffer_t *buf);
+void            st_key_buffer_set_action(st_key_buffer_t *buf, uint16_t action);
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+int             st_key_buffer_count_actions(const st_key_buffer_t *buf, int index);
+#endif
 void            st_key_buffer_print(const st_key_buffer_t *buf);
 void            st_key_buffer_push_seq_ref(st_key_buffer_t *buf, uint8_t triecode);
 uint8_t         st_key_buffer_get_seq_ref(const st_key_buffer_t * const buf, int index);
@@ -0,0 +1,164 @@
+// Copyright 2024 Guillaume Stordeur <guillaume.stordeur@gmail.com>
+// Copyright 2024 Matt Skalecki <ikcelaks@gmail.com>
+// Copyright 2024 QKekos <q.kekos.q@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+
+#include <string.h>
+#include "st_defaults.h"
+#include "qmk_wrapper.h"
+#include "latency.h"
+
+#if SEQUENCE_TRANSFORM_LATENCY_HISTOGRAMS
+
+#if defined(ST_TESTER) || defined(ST_HOST)
+#   include <time.h>
+#elif defined(PROTOCOL_CHIBIOS)
+#   include <ch.h>
+#endif
+
+static st_latency_histogram_t histograms[ST_LATENCY_SITE_COUNT];
+
+static const char *site_names[ST_LATENCY_SITE_COUNT] = {
+    [ST_LATENCY_PERFORM]        = "perform",
+    [ST_LATENCY_BACKSPACE]      = "backspace",
+    [ST_LATENCY_RULE_SEARCH]    = "rule_search",
+    [ST_LATENCY_TRIE_SEARCH]    = "trie_search",
+};
+
+//////////////////////////////////////////////////////////////////
+// Timestamp in the finest unit the platform has:
+// microseconds on host builds, system ticks on ChibiOS,
+// and milliseconds otherwise
+uint32_t st_latency_now(void)
+{
+#if defined(ST_TESTER) || defined(ST_HOST)
+#   ifdef WIN32
+    return (uint32_t)((uint64_t)clock() * 1000000 / CLOCKS_PER_SEC);
+#   else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+#   endif
+#elif defined(PROTOCOL_CHIBIOS)
+    return chVTGetSystemTimeX();
+#else
+    return timer_read32();
+#endif
+}
+//////////////////////////////////////////////////////////////////
+static uint32_t elapsed_us(uint32_t start)
+{
+#if defined(ST_TESTER) || defined(ST_HOST)
+    return st_latency_now() - start;
+#elif defined(PROTOCOL_CHIBIOS)
+    // system time may be narrower than 32 bits
+    return TIME_I2US(chTimeDiffX((systime_t)start, chVTGetSystemTimeX()));
+#else
+    return timer_elapsed32(start) * 1000;
+#endif
+}
+//////////////////////////////////////////////////////////////////
+// Smallest time st_latency_now can tell apart, in microseconds.
+// Calls faster than that are mostly counted as 0.
+static uint32_t resolution_us(void)
+{
+#if defined(ST_TESTER) || defined(ST_HOST)
+    return 1;
+#elif defined(PROTOCOL_CHIBIOS)
+    return MAX(TIME_I2US(1), 1);
+#else
+    return 1000;
+#endif
+}
+//////////////////////////////////////////////////////////////////
+void st_latency_record(st_latency_site_t site, uint32_t start)
+{
+    const uint32_t us = elapsed_us(start);
+    st_latency_histogram_t *h = &histograms[site];
+    if (!h->count || us < h->min_us) {
+        h->min_us = us;
+    }
+    if (us > h->max_us) {
+        h->max_us = us;
+    }
+    ++h->count;
+    h->total_us += us;
+    int bucket = 0;
+    for (uint32_t v = us; v && bucket < ST_LATENCY_BUCKET_COUNT - 1; v >>= 1) {
+        ++bucket;
+    }
+    ++h->buckets[bucket];
+}
+//////////////////////////////////////////////////////////////////
+// Estimates the time under which `permille` of the calls took, by
+// interpolating linearly within the bucket it falls in
+static uint32_t estimate_percentile(const st_latency_histogram_t *h, uint32_t permille)
+{
+    const uint32_t rank = (uint32_t)(((uint64_t)h->count * permille + 999) / 1000);
+    uint32_t seen = 0;
+    for (int bucket = 0; bucket < ST_LATENCY_BUCKET_COUNT; ++bucket) {
+        const uint32_t count = h->buckets[bucket];
+        if (seen + count < rank) {
+            seen += count;
+            continue;
+        }
+        const uint32_t lo = bucket ? 1UL << (bucket - 1) : 0;
+        const uint32_t hi = bucket < ST_LATENCY_BUCKET_COUNT - 1 ? 1UL << bucket : h->max_us;
+        uint32_t us = lo + (uint32_t)((uint64_t)(hi - lo) * (rank - seen) / count);
+        // the bucket bounds can be looser than the recorded extremes
+        return us < h->min_us ? h->min_us : us > h->max_us ? h->max_us : us;
+    }
+    return h->max_us;
+}
+//////////////////////////////////////////////////////////////////
+void st_latency_summarize(st_latency_site_t site, st_latency_summary_t *summary)
+{
+    const st_latency_histogram_t *h = &histograms[site];
+    summary->count = h->count;
+    summary->min_us = h->min_us;
+    summary->max_us = h->max_us;
+    summary->mean_us = h->count ? h->total_us / h->count : 0;
+    summary->p50_us = h->count ? estimate_percentile(h, 500) : 0;
+    summary->p99_us = h->count ? estimate_percentile(h, 990) : 0;
+}
+//////////////////////////////////////////////////////////////////
+const st_latency_histogram_t *st_latency_get(st_latency_site_t site)
+{
+    return &histograms[site];
+}
+//////////////////////////////////////////////////////////////////
+const char *st_latency_site_name(st_latency_site_t site)
+{
+    return site_names[site];
+}
+//////////////////////////////////////////////////////////////////
+// Prints a summary line and the non-empty buckets of every site
+void st_latency_dump(void)
+{
+    uprintf("st_latency resolution: %lu us\n", (unsigned long)resolution_us());
+    for (int site = 0; site < ST_LATENCY_SITE_COUNT; ++site) {
+        st_latency_summary_t s;
+        st_latency_summarize(site, &s);
+        uprintf("st_latency %s: count %lu, min %lu, max %lu, mean %lu, p50 %lu, p99 %lu us\n",
+            site_names[site], (unsigned long)s.count, (unsigned long)s.min_us, (unsigned long)s.max_us,
+            (unsigned long)s.mean_us, (unsigned long)s.p50_us, (unsigned long)s.p99_us);
+        for (int bucket = 0; bucket < ST_LATENCY_BUCKET_COUNT; ++bucket) {
+            const unsigned long count = histograms[site].buckets[bucket];
+            if (!count) {
+                continue;
+            }
+            if (bucket < ST_LATENCY_BUCKET_COUNT - 1) {
+                uprintf("  < %lu us: %lu\n", 1UL << bucket, count);
+            } else {
+                uprintf("  >= %lu us: %lu\n", 1UL << (bucket - 1), count);
+            }
+        }
+    }
+}
+//////////////////////////////////////////////////////////////////
+void st_latency_reset(void)
+{
+    memset(histograms, 0, sizeof(histograms));
+}
+
+#endif
@@ -0,0 +1,66 @@
+// Copyright 2024 Guillaume Stordeur <guillaume.stordeur@gmail.com>
+// Copyright 2024 Matt Skalecki <ikcelaks@gmail.com>
+// Copyright 2024 QKekos <q.kekos.q@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+//////////////////////////////////////////////////////////////////
+// Public API
+
+#if SEQUENCE_TRANSFORM_LATENCY_HISTOGRAMS
+
+typedef enum
+{
+    ST_LATENCY_PERFORM,         // st_perform, for every key
+    ST_LATENCY_BACKSPACE,       // st_handle_backspace (enhanced backspace)
+    ST_LATENCY_RULE_SEARCH,     // st_find_missed_rule
+    ST_LATENCY_TRIE_SEARCH,     // st_find_longest_chain, for every search
+    ST_LATENCY_SITE_COUNT
+} st_latency_site_t;
+
+// Bucket 0 counts calls under 1us, bucket n calls of [2^(n-1), 2^n) us.
+// The last bucket also counts anything longer.
+#define ST_LATENCY_BUCKET_COUNT 16
+
+typedef struct
+{
+    uint32_t    count;
+    uint32_t    min_us;
+    uint32_t    max_us;
+    uint32_t    total_us;
+    uint32_t    buckets[ST_LATENCY_BUCKET_COUNT];
+} st_latency_histogram_t;
+
+typedef struct
+{
+    uint32_t    count;
+    uint32_t    min_us;
+    uint32_t    max_us;
+    uint32_t    mean_us;
+    uint32_t    p50_us;     // estimated from the buckets
+    uint32_t    p99_us;
+} st_latency_summary_t;
+
+uint32_t    st_latency_now(void);
+void        st_latency_record(st_latency_site_t site, uint32_t start);
+void        st_latency_summarize(st_latency_site_t site, st_latency_summary_t *summary);
+const st_latency_histogram_t *st_latency_get(st_latency_site_t site);
+const char  *st_latency_site_name(st_latency_site_t site);
+void        st_latency_dump(void);
+void        st_latency_reset(void);
+
+// Time the instrumented sites into the histograms instead of printing
+#undef  st_log_time
+#undef  st_log_time_with_result
+#define st_log_time(S, F) { \
+            const uint32_t t = st_latency_now(); \
+            F; \
+            st_latency_record(S, t); \
+        }
+#define st_log_time_with_result(S, F, R) { \
+            const uint32_t t = st_latency_now(); \
+            *R = F; \
+            st_latency_record(S, t); \
+        }
+
+#endif
@@ -0,0 +1,105 @@
+// Copyright 2024 Guillaume Stordeur <guillaume.stordeur@gmail.com>
+// Copyright 2024 Matt Skalecki <ikcelaks@gmail.com>
+// Copyright 2024 QKekos <q.kekos.q@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+
+#include "st_defaults.h"
+#include "qmk_wrapper.h"
+#include "keybuffer.h"
+#include "no_match_cache.h"
+
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+
+//////////////////////////////////////////////////////////////////
+// Hashes the `window` most recent keys of the buffer.
+// A search only reads past the keys it matches when it converts to
+// an output cursor at a key that performed an action. Contexts with such
+// keys are not cached, so the result of a search depends only on the
+// keys within a window of SEQUENCE_MAX_LENGTH + 1 keys.
+// The buffer keeps running totals for each key, so this doesn't
+// have to rescan the window.
+// returns 0 if the context can't be cached
+uint32_t st_no_match_cache_hash(st_no_match_cache_t *cache, const st_key_buffer_t *buf)
+{
+    if (!cache->window_pow) {
+        cache->window_pow = 1;
+        for (int i = 0; i < cache->window; ++i) {
+            cache->window_pow *= ST_CONTEXT_HASH_MULT;
+        }
+    }
+    const st_key_action_t *newest = st_key_buffer_get(buf, 0);
+    const st_key_action_t *before = st_key_buffer_get(buf, cache->window);
+    uint32_t hash = newest->context_hash;
+    uint8_t actions = st_key_buffer_count_actions(buf, 0);
+    if (before) {
+        hash -= before->context_hash * cache->window_pow;
+        actions = newest->action_count - before->action_count;
+    }
+    if (actions) {
+        return 0;
+    }
+    // The low bits of a polynomial hash only depend on the low bits
+    // of the keys, mix the high bits in before they are used as the slot
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3bUL;
+    hash ^= hash >> 16;
+    return hash ? hash : 1;
+}
+//////////////////////////////////////////////////////////////////
+// Compares the keys stored with an entry to the buffer's,
+// so that a hash collision can't suppress a real match
+static bool tail_matches(const st_no_match_cache_t *cache, const st_key_buffer_t *buf, int slot)
+{
+    const uint8_t *tail = &cache->tails[slot * cache->window];
+    for (int i = 0; i < cache->window; ++i) {
+        // both are 0 past the end of a short buffer
+        if (tail[i] != st_key_buffer_get_triecode(buf, i)) {
+            return false;
+        }
+    }
+    return true;
+}
+//////////////////////////////////////////////////////////////////
+bool st_no_match_cache_contains(st_no_match_cache_t *cache, const st_key_buffer_t *buf, uint32_t hash)
+{
+#ifdef ST_TESTER
+    if (cache->disabled) {
+        return false;
+    }
+    ++cache->lookups;
+#endif
+    const int slot = hash & (cache->capacity - 1);
+    if (!hash || cache->tags[slot] != hash || !tail_matches(cache, buf, slot)) {
+        return false;
+    }
+#ifdef ST_TESTER
+    ++cache->hits;
+#endif
+    return true;
+}
+//////////////////////////////////////////////////////////////////
+void st_no_match_cache_add(st_no_match_cache_t *cache, const st_key_buffer_t *buf, uint32_t hash)
+{
+    if (!hash) {
+        return;
+    }
+    const int slot = hash & (cache->capacity - 1);
+    uint8_t *tail = &cache->tails[slot * cache->window];
+    for (int i = 0; i < cache->window; ++i) {
+        tail[i] = st_key_buffer_get_triecode(buf, i);
+    }
+    cache->tags[slot] = hash;
+}
+//////////////////////////////////////////////////////////////////
+void st_no_match_cache_reset(st_no_match_cache_t *cache)
+{
+    for (int i = 0; i < cache->capacity; ++i) {
+        cache->tags[i] = 0;
+    }
+#ifdef ST_TESTER
+    cache->lookups = 0;
+    cache->hits = 0;
+#endif
+}
+
+#endif
@@ -0,0 +1,27 @@
+// Copyright 2024 Guillaume Stordeur <guillaume.stordeur@gmail.com>
+// Copyright 2024 Matt Skalecki <ikcelaks@gmail.com>
+// Copyright 2024 QKekos <q.kekos.q@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+//////////////////////////////////////////////////////////////////
+// Public API
+
+typedef struct
+{
+    uint32_t * const    tags;       // context hashes of searches that found no match
+    uint8_t  * const    tails;      // the `window` most recent keys of each entry, to verify hits
+    const int           capacity;   // number of entries (must be a power of 2)
+    const int           window;     // number of keys a search can read (SEQUENCE_MAX_LENGTH + 1)
+    uint32_t            window_pow; // ST_CONTEXT_HASH_MULT ^ window, computed on first use
+#ifdef ST_TESTER
+    bool                disabled;   // lets the tester compare against uncached runs
+    long                lookups;
+    long                hits;
+#endif
+} st_no_match_cache_t;
+
+uint32_t    st_no_match_cache_hash(st_no_match_cache_t *cache, const st_key_buffer_t *buf);
+bool        st_no_match_cache_contains(st_no_match_cache_t *cache, const st_key_buffer_t *buf, uint32_t hash);
+void        st_no_match_cache_add(st_no_match_cache_t *cache, const st_key_buffer_t *buf, uint32_t hash);
+void        st_no_match_cache_reset(st_no_match_cache_t *cache);
@@ -11,23 +11,17 @@
 //////////////////////////////////////////////////////////////////////
 bool st_pred_upper_alpha(uint8_t triecode)
 {
-    const bool res = triecode >= 'A' && triecode <= 'Z';
-    st_debug(ST_DBG_SEQ_MATCH, " st_pred_upper_alpha: Res: %d; Code: %#04X\n", res, triecode);
-    return res;
+    return triecode >= 'A' && triecode <= 'Z';
 }
 //////////////////////////////////////////////////////////////////////
 bool st_pred_alpha(uint8_t triecode)
 {
-    const bool res = (triecode >= 'A' && triecode <= 'Z') || (triecode >= 'a' && triecode <= 'z');
-    st_debug(ST_DBG_SEQ_MATCH, " st_pred_alpha: Res: %d; Code: %#04X\n", res, triecode);
-    return res;
+    return (triecode >= 'A' && triecode <= 'Z') || (triecode >= 'a' && triecode <= 'z');
 }
 //////////////////////////////////////////////////////////////////////
 bool st_pred_digit(uint8_t triecode)
 {
-    const bool res = triecode >= '0' && triecode <= '9';
-    st_debug(ST_DBG_SEQ_MATCH, " st_pred_digit: Res: %d; Code: %#04X\n", res, triecode);
-    return res;
+    return triecode >= '0' && triecode <= '9';
 }
 //////////////////////////////////////////////////////////////////////
 bool st_pred_terminating_punct(uint8_t triecode)
@@ -43,7 +37,6 @@ bool st_pred_terminating_punct(uint8_t triecode)
             res = false;
             break;
     }
-    st_debug(ST_DBG_SEQ_MATCH, " st_pred_terminating_punct: Res: %d; Code: %#04X\n", res, triecode);
     return res;
 }
 //////////////////////////////////////////////////////////////////////
@@ -60,29 +53,23 @@ bool st_pred_nonterminating_punct(uint8_t triecode)
             res = false;
             break;
     }
-    st_debug(ST_DBG_SEQ_MATCH, " st_pred_nonterminating_punct: Res: %d; Code: %#04X\n", res, triecode);
     return res;
 }
 //////////////////////////////////////////////////////////////////////
 bool st_pred_punct(uint8_t triecode)
 {
-    const bool res = st_pred_terminating_punct(triecode) || st_pred_nonterminating_punct(triecode);
-    st_debug(ST_DBG_SEQ_MATCH, " st_pred_punct: Res: %d; Code: %#04X\n", res, triecode);
-    return res;
+    return st_pred_terminating_punct(triecode) || st_pred_nonterminating_punct(triecode);
 }
 //////////////////////////////////////////////////////////////////////
 bool st_pred_nonalpha(uint8_t triecode)
 {
-    const bool res = triecode < 0x80 && !st_pred_alpha(triecode);
-    st_debug(ST_DBG_SEQ_MATCH, " st_pred_nonalpha: Res: %d; Code: %#04X\n", res, triecode);
-    return res;
+    return triecode < 0x80 && !st_pred_alpha(triecode);
 }
 //////////////////////////////////////////////////////////////////////
 bool st_pred_any(uint8_t triecode)
 {
-    const bool res = true;
-    st_debug(ST_DBG_SEQ_MATCH, " st_pred_any: Res: %d; Code: %#04X\n", res, triecode);
-    return res;
+    (void)triecode;
+    return true;
 }
 //////////////////////////////////////////////////////////////////////
 static const st_predicate_t st_predicates[ST_PREDICATE_COUNT] = {
@@ -103,5 +90,7 @@ bool st_predicate_test_triecode(uint8_t predicate_index, uint8_t triecode)
     if (predicate_index >= ST_PREDICATE_COUNT) {
         return false;
     }
-    return st_predicates[predicate_index](triecode);
+    const bool res = st_predicates[predicate_index](triecode);
+    st_trace(ST_DBG_SEQ_MATCH, ST_TRACE_PREDICATE, 0, 0, 0, triecode, predicate_index + (res << 8));
+    return res;
 }
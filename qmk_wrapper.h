@@ -7,7 +7,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 
-#ifndef ST_TESTER
+#if !defined(ST_TESTER) && !defined(ST_HOST)
 
 // If a .c file needs a QMK include, this should add it here,
 // and include "qmk_wrapper.h" instead.
@@ -15,20 +15,21 @@
 #include "print.h"
 #include "send_string.h"
 
+// S is the st_latency_site_t of F (see latency.h)
 #if SEQUENCE_TRANSFORM_LOG_TIME
-#   define st_log_time(F) { \
+#   define st_log_time(S, F) { \
                const uint32_t t = timer_read32(); \
                F; \
                uprintf("%s time: %lu\n", #F, timer_elapsed32(t)); \
            }
-#   define st_log_time_with_result(F, R) { \
+#   define st_log_time_with_result(S, F, R) { \
                const uint32_t t = timer_read32(); \
                *R = F; \
                uprintf("%s time: %lu\n", #F, timer_elapsed32(t)); \
            }
 #else
-#   define st_log_time(F) F;
-#   define st_log_time_with_result(F, R) { \
+#   define st_log_time(S, F) F;
+#   define st_log_time_with_result(S, F, R) { \
                 *R = F; \
             }
 #endif
@@ -36,6 +37,7 @@
 #else
 
 // These includes don't require QMK objects to be linked with tester
+// or the host library (see host/)
 #include <stdio.h>
 #include <string.h>
 #include "quantum_keycodes.h"
@@ -44,8 +46,8 @@
 #define TEST_KC_SEQ_TOKEN_0 0x7E40
 
 #define uprintf printf
-#define st_log_time(F) F;
-#define st_log_time_with_result(F, R) { \
+#define st_log_time(S, F) F;
+#define st_log_time_with_result(S, F, R) { \
                 *R = F; \
         }
 
@@ -65,4 +67,4 @@ void    set_oneshot_mods(uint8_t mods);
 uint8_t get_mods(void);
 void    tap_code16(uint16_t k);
 
-#endif // ST_TESTER
+#endif // ST_TESTER || ST_HOST
@@ -8,3 +8,8 @@ LIB_SRC += sequence_transform/key_stack.c
 LIB_SRC += sequence_transform/triecodes.c
 LIB_SRC += sequence_transform/predicates.c
 LIB_SRC += sequence_transform/st_debug.c
+LIB_SRC += sequence_transform/no_match_cache.c
+LIB_SRC += sequence_transform/completions.c
+LIB_SRC += sequence_transform/storage.c
+LIB_SRC += sequence_transform/latency.c
+LIB_SRC += sequence_transform/undo_journal.c
@@ -14,113 +14,296 @@
 #include "triecodes.h"
 #include "sequence_transform.h"
 #include "sequence_transform_data.h"
+#include "no_match_cache.h"
+#include "undo_journal.h"
+#include "completions.h"
+#include "latency.h"
 #include "utils.h"
 
-#ifndef SEQUENCE_TRANSFORM_GENERATOR_VERSION_3_1
+#ifndef SEQUENCE_TRANSFORM_GENERATOR_VERSION_3_4
 #  error "sequence_transform_data.h was generated with an incompatible version of the generator script"
 #endif
-
-#if SEQUENCE_TRANSFORM_ENHANCED_BACKSPACE
-static bool post_process_do_enhanced_backspace = false;
-// Track backspace hold time
-static uint32_t backspace_timer = 0;
+#if SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS && COMPLETIONS_HUFFMAN_SIZE == 0
+#  error "The generator couldn't entropy code these completions, disable SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS"
 #endif
 
 #if SEQUENCE_TRANSFORM_RULE_SEARCH
-static bool post_process_do_rule_search = false;
-void schedule_rule_search(void)
+void schedule_rule_search(st_engine_t *engine)
 {
-    post_process_do_rule_search = true;
+    engine->post_process_do_rule_search = true;
 }
-#else
-void schedule_rule_search(void){}
 #endif
 
-#define KEY_AT(i) st_key_buffer_get_triecode(&key_buffer, (i))
+#define KEY_AT(i) st_key_buffer_get_triecode(&engine->key_buffer, (i))
 
 //////////////////////////////////////////////////////////////////
 // Key history buffer
 #define KEY_BUFFER_CAPACITY MIN(255, SEQUENCE_MAX_LENGTH + COMPLETION_MAX_LENGTH + SEQUENCE_TRANSFORM_EXTRA_BUFFER)
-static st_key_action_t key_buffer_data[KEY_BUFFER_CAPACITY] = {{' ', 0, ST_DEFAULT_KEY_ACTION}};
-static uint8_t seq_ref_cache[KEY_BUFFER_CAPACITY*2] = {'\0'};
-static st_key_buffer_t key_buffer = {
-    key_buffer_data,
-    KEY_BUFFER_CAPACITY,
-    1,
-    0,
-    seq_ref_cache,
-    KEY_BUFFER_CAPACITY*2,
-    1,
-    0
-};
-
-//////////////////////////////////////////////////////////////////////////////////////////
-uint16_t sequence_transform_past_keycode(int index) {
-    return st_key_buffer_get_triecode(&key_buffer, index);
-}
-
-//////////////////////////////////////////////////////////////////////////////////////////
-// Reset buffer on timeout
-#if SEQUENCE_TRANSFORM_IDLE_TIMEOUT > 0
-static uint32_t sequence_timer = 0;
-void sequence_transform_task(void) {
-    if (key_buffer.size > 1 &&
-        timer_elapsed32(sequence_timer) > SEQUENCE_TRANSFORM_IDLE_TIMEOUT) {
-        st_key_buffer_reset(&key_buffer);
-        sequence_timer = timer_read32();
-    }
-}
+static st_key_action_t key_buffer_data[KEY_BUFFER_CAPACITY] = {{' ', 0, ST_DEFAULT_KEY_ACTION,
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+    ' ', 0
 #endif
+}};
+static uint8_t seq_ref_cache[KEY_BUFFER_CAPACITY*2] = {'\0'};
 
 //////////////////////////////////////////////////////////////////
 // Trie key stack used for searches
 #define ST_STACK_SIZE MAX(SEQUENCE_MAX_LENGTH, MAX_BACKSPACES + TRANSFORM_MAX_LENGTH)
 static uint8_t trie_key_stack_data[ST_STACK_SIZE] = {0};
-static st_key_stack_t trie_stack = {
-    trie_key_stack_data,
-    ST_STACK_SIZE,
-    0
-};
 
 //////////////////////////////////////////////////////////////////
 // Trie node and completion data
 static const st_trie_t trie = {
+#if SEQUENCE_TRANSFORM_TRIE_ALIGNED
+    SEQUENCE_TRIE_ALIGNED_SIZE,
+    sequence_transform_trie_aligned,
+#else
     SEQUENCE_TRIE_SIZE,
     sequence_transform_trie,
+#endif
+    TRIE_PAYLOADS_SIZE,
+#if TRIE_PAYLOAD_INDEX_SIZE > 0
+    sequence_transform_payloads,
+#else
+    0,
+#endif
+#if defined(ST_TESTER) || defined(ST_HOST)
+    TRIE_PAYLOAD_INDEX_SIZE,
+#endif
+#if SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS
+    COMPLETIONS_HUFFMAN_SIZE,
+    sequence_transform_completions_huffman,
+#else
     COMPLETIONS_SIZE,
     sequence_transform_completions_data,
+#endif
+#if SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS
+    sequence_transform_completion_code_counts,
+    COMPLETION_CODE_MAX_LENGTH,
+    sequence_transform_completion_code_symbols,
+    sequence_transform_completion_checkpoints,
+    COMPLETION_CHECKPOINT_COUNT,
+#endif
+    SEQUENCE_MAX_LENGTH,
     COMPLETION_MAX_LENGTH,
-    MAX_BACKSPACES
+    MAX_BACKSPACES,
+#if SEQUENCE_TRANSFORM_TRIGGER_FILTER
+    sequence_transform_trigger_keys,
+#else
+    0,
+#endif
+#if SEQUENCE_TRANSFORM_TRIGGER_PAIR_FILTER
+    sequence_transform_trigger_pair_index,
+    sequence_transform_trigger_pair_rows,
+#else
+    0,
+    0,
+#endif
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+    0,
+    0,
+    0,
+    0,
+#endif
 };
 
+#if SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS
 //////////////////////////////////////////////////////////////////
-// Trie cursor
-static st_cursor_t trie_cursor = {
-    &key_buffer,
+// Trie cursor decoded completion
+static uint8_t trie_cursor_completion[COMPLETION_MAX_LENGTH] = {0};
+#endif
+
+//////////////////////////////////////////////////////////////////
+// Trie cursor multi-branch backtrack stack, sized by the generator
+// for the deepest nesting of multi-branches in the trie
+#define ST_BRANCH_STACK_SIZE MAX(TRIE_MULTI_BRANCH_MAX_DEPTH, 1)
+static st_trie_branch_t trie_branch_stack[ST_BRANCH_STACK_SIZE];
+
+//////////////////////////////////////////////////////////////////
+// Cache of recent key contexts for which no rule matched
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+#  if (SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE & (SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE - 1)) != 0
+#    error "SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE must be a power of 2"
+#  endif
+static uint32_t no_match_cache_tags[SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE] = {0};
+static uint8_t no_match_cache_tails[SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE * (SEQUENCE_MAX_LENGTH + 1)] = {0};
+#endif
+
+//////////////////////////////////////////////////////////////////
+// Edits of recent rule actions, and the chars each one deleted
+#if SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE > 0
+#define ST_UNDO_MAX_RESTORE (MAX_BACKSPACES + 1)
+static st_undo_entry_t undo_journal_entries[SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE];
+static uint8_t undo_journal_text[SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE * ST_UNDO_MAX_RESTORE] = {0};
+static uint8_t undo_journal_output[ST_UNDO_MAX_RESTORE] = {0};
+#endif
+
+//////////////////////////////////////////////////////////////////
+// Default engine, used by the single instance QMK API
+static st_engine_t default_engine = {
     &trie,
-    {0, 255,0, false},
-    {0},
+    {
+        key_buffer_data,
+        KEY_BUFFER_CAPACITY,
+        1,
+        0,
+        seq_ref_cache,
+        KEY_BUFFER_CAPACITY*2,
+        1,
+        0,
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+        0
+#endif
+    },
+    {
+        trie_key_stack_data,
+        ST_STACK_SIZE,
+        0
+    },
+    {
+        &default_engine.key_buffer,
+        &trie,
+        {0, 255,0, false},
+        {0},
+#if SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS
+        trie_cursor_completion,
+#endif
+        false,
+        0,
+        trie_branch_stack,
+        ST_BRANCH_STACK_SIZE,
+        {0},
+#ifdef ST_TESTER
+        0,
+        false,
+#endif
+    },
+    0,
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+    {
+        no_match_cache_tags,
+        no_match_cache_tails,
+        SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE,
+        SEQUENCE_MAX_LENGTH + 1,
+        0,
+#ifdef ST_TESTER
+        false,
+        0,
+        0,
+#endif
+    },
+#endif
+#if SEQUENCE_TRANSFORM_IDLE_TIMEOUT > 0
+    0,
+#endif
+#if SEQUENCE_TRANSFORM_ENHANCED_BACKSPACE
+    0,
+    false,
+#endif
+#if SEQUENCE_TRANSFORM_BACKSPACE_REPEAT > 0
     false,
+    false,
+#endif
+#if SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE > 0
+    {
+        undo_journal_entries,
+        undo_journal_text,
+        undo_journal_output,
+        SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE,
+        ST_UNDO_MAX_RESTORE,
+        0,
+        0,
+        0,
+        0
+    },
+#endif
+#if SEQUENCE_TRANSFORM_RULE_SEARCH
+    false,
+#endif
 };
 
+// Engine used by the single instance API. Host builds can switch it to
+// one using dictionary data loaded at runtime (see host/st_blob.c).
+// A null engine switches back to the compiled in one.
+#if defined(ST_TESTER) || defined(ST_HOST)
+static st_engine_t *engine_instance = &default_engine;
+void st_set_engine(st_engine_t *engine) { engine_instance = engine ? engine : &default_engine; }
+#else
+#define engine_instance (&default_engine)
+#endif
+
+st_engine_t *st_get_engine(void) { return engine_instance; }
+
 //////////////////////////////////////////////////////////////////
 #ifdef ST_TESTER
-const st_trie_t *st_get_trie(void) { return &trie; }
-st_key_buffer_t *st_get_key_buffer(void) { return &key_buffer; }
-st_cursor_t     *st_get_cursor(void) { return &trie_cursor; }
+const st_trie_t *st_get_trie(void) { return engine_instance->trie; }
+st_key_buffer_t *st_get_key_buffer(void) { return &engine_instance->key_buffer; }
+st_cursor_t     *st_get_cursor(void) { return &engine_instance->trie_cursor; }
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+st_no_match_cache_t *st_get_no_match_cache(void) { return &engine_instance->no_match_cache; }
+#endif
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////////////
+uint16_t st_engine_past_keycode(const st_engine_t *engine, int index) {
+    return st_key_buffer_get_triecode(&engine->key_buffer, index);
+}
+uint16_t sequence_transform_past_keycode(int index) {
+    return st_engine_past_keycode(engine_instance, index);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Forgets the keys typed so far, and what was sent for them
+void st_engine_reset(st_engine_t *engine) {
+    st_key_buffer_reset(&engine->key_buffer);
+#if SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE > 0
+    st_undo_journal_reset(&engine->undo_journal);
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Repeat a held backspace, and reset buffer on timeout
+#if SEQUENCE_TRANSFORM_IDLE_TIMEOUT > 0 || SEQUENCE_TRANSFORM_BACKSPACE_REPEAT > 0
+void st_engine_task(st_engine_t *engine) {
+#if SEQUENCE_TRANSFORM_BACKSPACE_REPEAT > 0
+    const uint32_t repeat_delay = engine->backspace_repeating ? SEQUENCE_TRANSFORM_BACKSPACE_REPEAT : TAPPING_TERM;
+    if (engine->backspace_held && timer_elapsed32(engine->backspace_timer) > repeat_delay) {
+        // each repeat undoes one more key, as a tap would
+        engine->backspace_timer = timer_read32();
+        engine->backspace_repeating = true;
+        tap_code16(KC_BSPC);
+        st_log_time(ST_LATENCY_BACKSPACE, st_handle_backspace(engine));
+#if SEQUENCE_TRANSFORM_IDLE_TIMEOUT > 0
+        engine->sequence_timer = timer_read32();
+#endif
+    }
+#endif
+#if SEQUENCE_TRANSFORM_IDLE_TIMEOUT > 0
+    if (engine->key_buffer.size > 1 &&
+        timer_elapsed32(engine->sequence_timer) > SEQUENCE_TRANSFORM_IDLE_TIMEOUT) {
+        st_engine_reset(engine);
+        engine->sequence_timer = timer_read32();
+    }
+#endif
+}
+void sequence_transform_task(void) {
+    st_engine_task(engine_instance);
+}
 #endif
 
 /**
  * @brief determine if sequence_transform should process this keypress,
  *        and remove any mods from keycode.
  *
+ * @param engine sequence transform engine
  * @param keycode Keycode registered by matrix press, per keymap
  * @param record keyrecord_t structure
  * @param mods allow processing of mod status
  * @return true Allow sequence_transform
  * @return false Stop processing and escape from sequence_transform
  */
-bool st_process_check(uint16_t *keycode,
+bool st_process_check(st_engine_t *engine,
+                      uint16_t *keycode,
                       const keyrecord_t *record,
                       uint8_t *mods) {
     // See quantum_keycodes.h for reference on these matched ranges.
@@ -210,7 +393,7 @@ bool st_process_check(uint16_t *keycode,
     // Disable autocorrect while a mod other than shift is active.
     if (((*mods | QK_MODS_GET_MODS(*keycode)) & ~MOD_MASK_SHIFT) != 0) {
         st_debug(ST_DBG_GENERAL, "clearing buffer (mods: 0x%04X)\n", *mods);
-        st_key_buffer_reset(&key_buffer);
+        st_engine_reset(engine);
         return false;
     }
 
@@ -230,7 +413,7 @@ __attribute__((weak)) void sequence_transform_on_missed_rule_user(const st_trie_
 #endif
 }
 //////////////////////////////////////////////////////////////////////
-void st_find_missed_rule(void)
+void st_find_missed_rule(st_engine_t *engine)
 {
 #if SEQUENCE_TRANSFORM_RULE_SEARCH
     char sequence_str[SEQUENCE_MAX_LENGTH + 1] = {0};
@@ -239,65 +422,134 @@ void st_find_missed_rule(void)
     // first skipping past trailing spaces
     // (in case a rule has spaces at the end of its completion)
     int word_start_idx = 0;
-    while (word_start_idx < key_buffer.size &&
+    while (word_start_idx < engine->key_buffer.size &&
            KEY_AT(word_start_idx) == ' ') {
         ++word_start_idx;
     }
     // if we reached the end of the buffer here,
     // it means it's filled wish spaces, so bail.
-    if (word_start_idx == key_buffer.size) {
+    if (word_start_idx == engine->key_buffer.size) {
         return;
     }
     // we've skipped trailing spaces, so now find the next space
-    while (word_start_idx < key_buffer.size &&
+    while (word_start_idx < engine->key_buffer.size &&
            KEY_AT(word_start_idx) != ' ') {
         ++word_start_idx;
     }
     st_trie_rule_t result = {{0}, sequence_str, transform_str};
-    if (st_trie_do_rule_searches(&trie,
-                                 &key_buffer,
-                                 &trie_stack,
+    if (st_trie_do_rule_searches(engine->trie,
+                                 &engine->key_buffer,
+                                 &engine->trie_stack,
                                  word_start_idx,
                                  &result)) {
         sequence_transform_on_missed_rule_user(&result);
     }
+#else
+    (void)engine;
 #endif
 }
 //////////////////////////////////////////////////////////////////
-bool st_handle_completion(st_cursor_t *cursor, st_key_stack_t *stack)
+// Engine output goes to QMK, unless it is being collected
+// into a batch by st_engine_feed_keys
+static void st_output_key(st_engine_t *engine, uint8_t triecode)
 {
+#if SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE > 0
+    st_undo_journal_output_key(&engine->undo_journal, triecode);
+#endif
+    if (engine->feed_batch) {
+        st_key_stack_push(&engine->feed_batch->output, triecode);
+    } else {
+        st_send_key(st_ascii_to_keycode(triecode));
+    }
+}
+//////////////////////////////////////////////////////////////////
+static void st_batch_backspaces(st_feed_batch_t *batch, int count)
+{
+    // backspaces cancel batch output first
+    for (; count > 0 && batch->output.size > 0; --count) {
+        st_key_stack_pop(&batch->output);
+    }
+    batch->backspaces += count;
+}
+//////////////////////////////////////////////////////////////////
+static void st_output_backspaces(st_engine_t *engine, int count)
+{
+#if SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE > 0
+    st_undo_journal_output_backspaces(&engine->undo_journal, count);
+#endif
+    if (engine->feed_batch) {
+        st_batch_backspaces(engine->feed_batch, count);
+    } else {
+        st_multi_tap(KC_BSPC, count);
+    }
+}
+//////////////////////////////////////////////////////////////////
+// Sends the completion of the most recent key's action. Seq refs
+// resolve to the symbols `match` captured, or are read back from the
+// key buffer for positions it didn't capture.
+bool st_handle_completion(st_engine_t *engine, const st_trie_match_t *match)
+{
+    st_cursor_t *cursor = &engine->trie_cursor;
     const st_trie_payload_t *action = st_cursor_get_action(cursor);
     const uint16_t completion_start = action->completion_index;
     if (!action || completion_start == ST_DEFAULT_KEY_ACTION) {
         return false;
     }
-    stack->size = 0;
-    const uint16_t completion_end = completion_start + action->completion_len;
-    for (int i = completion_start; i < completion_end; ++i) {
-        uint8_t triecode = CDATA(cursor->trie, i);
+    engine->trie_stack.size = 0;
+    const int completion_len = action->completion_len;
+    st_completion_reader_t reader;
+    st_completion_reader_init(&reader, cursor->trie, completion_start);
+    for (int i = 0; i < completion_len; ++i) {
+        uint8_t triecode = st_completion_reader_next(&reader);
         if (st_is_trans_seq_ref_triecode(triecode)) {
-            triecode = st_cursor_get_seq_ascii(cursor, triecode);
+            const int pos = st_get_seq_ref_triecode_pos(triecode);
+            triecode = pos < match->seq_symbol_count
+                ? match->seq_symbols[pos]
+                : st_cursor_get_seq_ascii(cursor, triecode);
             st_assert(triecode, "Unable to retrieve seq ref (%d) needed to produce the completion\n", triecode);
-            st_key_buffer_push_seq_ref(&key_buffer, triecode);
+            st_key_buffer_push_seq_ref(&engine->key_buffer, triecode);
         }
-        st_send_key(st_ascii_to_keycode(triecode));
+        st_output_key(engine, triecode);
     }
     return true;
 }
 //////////////////////////////////////////////////////////////////////////////////////////
-void st_handle_result(const st_trie_t *trie,
+#if SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE > 0
+// Records what undoing the action of the most recent key will take:
+// the backspaces beyond the natural one, and the chars it deletes
+// (plus the one before them when the natural backspace is unwanted),
+// copied from the recent output before its backspaces are sent
+static void st_journal_edit(st_engine_t *engine, const st_trie_search_result_t *res)
+{
+    int backspaces = res->trie_payload.completion_len - 1;
+    int restore_len = res->trie_payload.num_backspaces;
+    if (backspaces < 0) {
+        restore_len -= backspaces;
+        backspaces = 0;
+    }
+    if (!st_undo_journal_push(&engine->undo_journal,
+            res->trie_match.trie_match_index, backspaces, restore_len)) {
+        st_debug(ST_DBG_BACKSPACE, "Deleted chars weren't sent since the last reset, not journaled\n");
+    }
+}
+#endif
+//////////////////////////////////////////////////////////////////////////////////////////
+void st_handle_result(st_engine_t *engine,
                       const st_trie_search_result_t *res) {
     // Most recent key in the buffer triggered a match action, record it in the buffer
-    st_key_action_t *current_key = st_key_buffer_get(&key_buffer, 0);
-    current_key->action_taken = res->trie_match.trie_match_index;
+    st_key_action_t *current_key = st_key_buffer_get(&engine->key_buffer, 0);
+    st_key_buffer_set_action(&engine->key_buffer, res->trie_match.trie_match_index);
     current_key->is_anchor_match = !res->trie_match.is_chained_match;
     // Log newly added rule match
     log_rule(res->trie_match.trie_match_index);
+#if SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE > 0
+    st_journal_edit(engine, res);
+#endif
     // Send backspaces
-    st_multi_tap(KC_BSPC, res->trie_payload.num_backspaces);
+    st_output_backspaces(engine, res->trie_payload.num_backspaces);
     // Send completion string
-    st_cursor_init(&trie_cursor, 0, false);
-    st_handle_completion(&trie_cursor, &trie_stack);
+    st_cursor_init(&engine->trie_cursor, 0, false);
+    st_handle_completion(engine, &res->trie_match);
     switch (res->trie_payload.func_code) {
         case 2:  // set one-shot shift
             set_oneshot_mods(MOD_LSFT);
@@ -306,18 +558,42 @@ void st_handle_result(const st_trie_t *trie,
 }
 //////////////////////////////////////////////////////////////////////////////////////////
 #if SEQUENCE_TRANSFORM_ENHANCED_BACKSPACE
-void st_handle_backspace() {
-    // initialize cursor as input cursor, so that `st_cursor_get_action` is stable
-    st_cursor_init(&trie_cursor, 0, false);
-    const st_trie_payload_t *action = st_cursor_get_action(&trie_cursor);
-    if (action->completion_index == ST_DEFAULT_KEY_ACTION) {
+void st_handle_backspace(st_engine_t *engine) {
+    st_key_buffer_t *key_buffer = &engine->key_buffer;
+    st_key_stack_t *trie_stack = &engine->trie_stack;
+    st_cursor_t *trie_cursor = &engine->trie_cursor;
+#if SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE > 0
+    st_undo_journal_t *journal = &engine->undo_journal;
+    // backspace was already sent on keydown
+    st_undo_journal_output_backspaces(journal, 1);
+#endif
+    const uint16_t action_taken = st_key_buffer_get(key_buffer, 0)->action_taken;
+    if (action_taken == ST_DEFAULT_KEY_ACTION) {
         // previous key-press didn't trigger a rule action. One total backspace required
         st_debug(ST_DBG_BACKSPACE, "Undoing backspace after non-matching keypress\n");
-        // backspace was already sent on keydown
-        st_key_buffer_pop(&key_buffer);
+        st_key_buffer_pop(key_buffer);
         return;
     }
     // Undo a rule action
+#if SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE > 0
+    const uint8_t *restore = 0;
+    const st_undo_entry_t *edit = st_undo_journal_peek(journal, action_taken, &restore);
+    if (edit) {
+        st_debug(ST_DBG_BACKSPACE, "Undoing previous key action: bs: %d, restore: %d\n",
+            edit->backspaces, edit->restore_len);
+        st_output_backspaces(engine, edit->backspaces);
+        for (int i = 0; i < edit->restore_len; ++i) {
+            st_output_key(engine, restore[i]);
+        }
+        st_undo_journal_pop(journal);
+        st_key_buffer_pop(key_buffer);
+        return;
+    }
+    // Not in the journal: work out the deleted output from the trie.
+#endif
+    // initialize cursor as input cursor, so that `st_cursor_get_action` is stable
+    st_cursor_init(trie_cursor, 0, false);
+    const st_trie_payload_t *action = st_cursor_get_action(trie_cursor);
     int backspaces_needed_count = action->completion_len - 1;
     int resend_count = action->num_backspaces;
     if (backspaces_needed_count < 0) {
@@ -330,42 +606,206 @@ void st_handle_backspace() {
     // If previous action used backspaces, restore the deleted output from earlier actions
     if (resend_count > 0) {
         // reinitialize cursor as output cursor one keystroke before the previous action
-        if (st_cursor_init(&trie_cursor, 1, true) &&
-            st_cursor_push_to_stack(&trie_cursor, &trie_stack, resend_count)) {
+        if (st_cursor_init(trie_cursor, 1, true) &&
+            st_cursor_push_to_stack(trie_cursor, trie_stack, resend_count)) {
             // Send backspaces now that we know we can do the full undo
-            st_multi_tap(KC_BSPC, backspaces_needed_count);
+            st_output_backspaces(engine, backspaces_needed_count);
             // Send saved keys in original order
-            for (int i = trie_stack.size - 1; i >= 0; --i) {
-                st_send_key(st_ascii_to_keycode(trie_stack.buffer[i]));
+            for (int i = trie_stack->size - 1; i >= 0; --i) {
+                st_output_key(engine, trie_stack->buffer[i]);
             }
         } else {
             // The output state is no longer confidently known.
             // Reset the buffer to prevent unintended matches.
-            st_key_buffer_reset(&key_buffer);
+            st_engine_reset(engine);
             return;
         }
     } else {
         // Send backspaces since no resend is needed to complete the undo
-        st_multi_tap(KC_BSPC, backspaces_needed_count);
+        st_output_backspaces(engine, backspaces_needed_count);
     }
-    st_key_buffer_pop(&key_buffer);
+    st_key_buffer_pop(key_buffer);
+}
+//////////////////////////////////////////////////////////////////////////////////////////
+// Undoes the `n` most recent key presses at once, as if backspace was
+// tapped n times, none of which have been sent yet.
+// The net edit is collected in `batch`: chars one undo restores that
+// the next one deletes again cancel out instead of being sent.
+// Returns the number of key presses undone, which is less than `n`
+// if the batch filled up.
+int st_engine_undo(st_engine_t *engine, int n, st_feed_batch_t *batch)
+{
+    // most output undoing a single key can add to the batch
+    const int max_key_output = engine->trie->max_backspaces + 1;
+    st_key_stack_reset(&batch->output);
+    batch->backspaces = 0;
+    batch->transforms = 0;
+    engine->feed_batch = batch;
+    int i = 0;
+    for (; i < n && batch->output.size + max_key_output <= batch->output.capacity; ++i) {
+        // the backspace QMK would have sent on keydown,
+        // which st_handle_backspace records itself
+        st_batch_backspaces(batch, 1);
+        st_handle_backspace(engine);
+    }
+    engine->feed_batch = 0;
+    return i;
 }
 #endif
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// st_perform, once the trigger filters have passed
+static bool st_perform_search(st_engine_t *engine) {
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+    const uint32_t context_hash = st_no_match_cache_hash(&engine->no_match_cache, &engine->key_buffer);
+    if (st_no_match_cache_contains(&engine->no_match_cache, &engine->key_buffer, context_hash)) {
+        // The same recent keys didn't match anything last time
+        return false;
+    }
+#endif
+    // Get completion string from trie for our current key buffer.
+    st_trie_search_result_t res = {{0,  {0, 0, 0, 0}, 0, 0, {0}}, {0,  0,  0, 0}};
+    if (st_trie_get_completion(&engine->trie_cursor, &res)) {
+        st_handle_result(engine, &res);
+        return true;
+    }
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+    st_no_match_cache_add(&engine->no_match_cache, &engine->key_buffer, context_hash);
+#endif
+    return false;
+}
+
 /**
  * @brief Performs sequence transform if a match is found in the trie
  *
+ * @param engine sequence transform engine
  * @return true if sequence transform was performed
  */
-bool st_perform() {
-    // Get completion string from trie for our current key buffer.
-    st_trie_search_result_t res = {{0,  {0, 0, 0}, 0}, {0,  0,  0, 0}};
-    if (st_trie_get_completion(&trie_cursor, &res)) {
-        st_handle_result(&trie, &res);
+bool st_perform(st_engine_t *engine) {
+    if (st_trie_can_trigger(engine->trie, &engine->key_buffer) &&
+        st_perform_search(engine)) {
         return true;
     }
+#if SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE > 0
+    // the key is let through, as typed
+    st_undo_journal_output_key(&engine->undo_journal, KEY_AT(0));
+#endif
     return false;
 }
+/**
+ * @brief Feeds a run of keys as if they were pressed one at a time,
+ *        collecting their output into one batch instead of sending it.
+ *
+ * Keys are triecodes (see st_keycode_to_triecode), and 0 resets the
+ * buffer like a key that can't be processed. Keys that can't end any
+ * sequence are only pushed to the key buffer, so the search, the
+ * no-match cache and the cursor are only used for possible triggers.
+ *
+ * @param engine sequence transform engine
+ * @param triecodes keys to feed
+ * @param n number of keys
+ * @param batch receives the net output, including untransformed keys
+ * @return number of keys fed, less than n if the batch output is full
+ */
+int st_engine_feed_keys(st_engine_t *engine,
+                        const uint8_t *triecodes,
+                        int n,
+                        st_feed_batch_t *batch)
+{
+    st_key_buffer_t *key_buffer = &engine->key_buffer;
+    // most output a single key can add to the batch
+    const int max_key_output = engine->trie->completion_max_len + 1;
+    st_key_stack_reset(&batch->output);
+    batch->backspaces = 0;
+    batch->transforms = 0;
+    engine->feed_batch = batch;
+    // previous key, or 0 if it isn't read as input by a search
+    const st_key_action_t *prev = st_key_buffer_get(key_buffer, 0);
+    uint8_t prev_triecode = prev && prev->action_taken == ST_DEFAULT_KEY_ACTION ? prev->triecode : 0;
+    int i = 0;
+    for (; i < n && batch->output.size + max_key_output <= batch->output.capacity; ++i) {
+        if (!triecodes[i]) {
+            st_engine_reset(engine);
+            prev_triecode = KEY_AT(0);
+            continue;
+        }
+        st_key_buffer_push(key_buffer, triecodes[i]);
+        const uint8_t triecode = KEY_AT(0);
+        if (st_trie_can_trigger_keys(engine->trie, triecode, prev_triecode) &&
+            st_perform_search(engine)) {
+            ++batch->transforms;
+            prev_triecode = 0;
+        } else {
+            st_output_key(engine, triecodes[i]);
+            prev_triecode = triecode;
+        }
+    }
+    engine->feed_batch = 0;
+    return i;
+}
+//////////////////////////////////////////////////////////////////////////////////////////
+static void st_send_batch(const st_feed_batch_t *batch)
+{
+    st_multi_tap(KC_BSPC, batch->backspaces);
+    for (int i = 0; i < batch->output.size; ++i) {
+        // sequence tokens don't type anything by themselves
+        if (!st_is_seq_token_triecode(batch->output.buffer[i])) {
+            st_send_key(st_ascii_to_keycode(batch->output.buffer[i]));
+        }
+    }
+}
+//////////////////////////////////////////////////////////////////////////////////////////
+// Feeds keys to the default engine, sending the output of each batch to QMK.
+// Returns the number of keys that performed a rule, or -1 if completions
+// of the engine's rules don't fit the batch (a loaded engine can have
+// longer completions than the compiled in rules).
+#define FEED_OUTPUT_CAPACITY (2 * (COMPLETION_MAX_LENGTH + 1))
+int st_feed_keys(const uint8_t *triecodes, int n)
+{
+    if (engine_instance->trie->completion_max_len + 1 > FEED_OUTPUT_CAPACITY) {
+        st_debug(ST_DBG_GENERAL, "st_feed_keys: completions of this engine's trie don't fit the batch\n");
+        return -1;
+    }
+    uint8_t output_data[FEED_OUTPUT_CAPACITY];
+    st_feed_batch_t batch = {{output_data, FEED_OUTPUT_CAPACITY, 0}, 0, 0};
+    int transforms = 0;
+    while (n > 0) {
+        // always feeds at least one key into an empty batch
+        const int fed = st_engine_feed_keys(engine_instance, triecodes, n, &batch);
+        st_send_batch(&batch);
+        transforms += batch.transforms;
+        triecodes += fed;
+        n -= fed;
+    }
+    return transforms;
+}
+#if SEQUENCE_TRANSFORM_ENHANCED_BACKSPACE
+//////////////////////////////////////////////////////////////////////////////////////////
+// Undoes the `n` most recent key presses of the default engine, as if
+// backspace was tapped n times, and sends QMK the net edit.
+// Use it for bursts of backspaces that haven't been sent yet
+// (ex: a custom keycode that deletes a word).
+// Returns the number of key presses undone, or -1 if the engine's
+// rules can restore more chars than the batch holds (a loaded engine
+// can have more backspaces than the compiled in rules).
+#define UNDO_OUTPUT_CAPACITY (4 * (MAX_BACKSPACES + 1))
+int st_undo(int n)
+{
+    if (engine_instance->trie->max_backspaces + 1 > UNDO_OUTPUT_CAPACITY) {
+        st_debug(ST_DBG_BACKSPACE, "st_undo: restores of this engine's trie don't fit the batch\n");
+        return -1;
+    }
+    uint8_t output_data[UNDO_OUTPUT_CAPACITY];
+    st_feed_batch_t batch = {{output_data, UNDO_OUTPUT_CAPACITY, 0}, 0, 0};
+    int undone = 0;
+    while (undone < n) {
+        // always undoes at least one key into an empty batch
+        undone += st_engine_undo(engine_instance, n - undone, &batch);
+        st_send_batch(&batch);
+    }
+    return undone;
+}
+#endif
 
 /**
  * @return false if we should reset the buffer and skip sequence matching
@@ -385,44 +825,66 @@ bool st_is_processable_keycode(uint16_t keycode)
 
 /**
  * @brief sets flag to later perform enhanced backspace
- *        or simply clears the buffer on key hold
+ *        and repeats it or simply clears the buffer on key hold
+ *
+ * @return true if QMK should send the backspace to the host
  */
-void st_on_backspace(keyrecord_t *record)
+bool st_on_backspace(st_engine_t *engine, keyrecord_t *record)
 {
 #if SEQUENCE_TRANSFORM_ENHANCED_BACKSPACE
     if (record->event.pressed) {
-        backspace_timer = timer_read32();
+        engine->backspace_timer = timer_read32();
+#if SEQUENCE_TRANSFORM_BACKSPACE_REPEAT > 0
+        // Tapped here and repeated by st_engine_task while held, so that
+        // the host's key repeat doesn't delete chars we can't account for.
+        // The key isn't passed on, so QMK won't call post_process_sequence_transform,
+        // undo right away like the repeats do.
+        engine->backspace_held = true;
+        engine->backspace_repeating = false;
+        tap_code16(KC_BSPC);
+        st_log_time(ST_LATENCY_BACKSPACE, st_handle_backspace(engine));
+        return false;
+#else
         // set flag so that post_process_sequence_transform will perfom an undo
-        post_process_do_enhanced_backspace = true;
-        return;
+        engine->post_process_do_enhanced_backspace = true;
+        return true;
+#endif
     }
     // This is a release
-    if (timer_elapsed32(backspace_timer) > TAPPING_TERM) {
+#if SEQUENCE_TRANSFORM_BACKSPACE_REPEAT > 0
+    engine->backspace_held = false;
+    return false;
+#else
+    if (timer_elapsed32(engine->backspace_timer) > TAPPING_TERM) {
         // Clear the buffer if the backspace key was held past the tapping term
-        st_key_buffer_reset(&key_buffer);
+        st_engine_reset(engine);
     }
+#endif
 #else
     if (record->event.pressed) {
-        st_key_buffer_reset(&key_buffer);
+        st_engine_reset(engine);
     }
 #endif
+    return true;
 }
 
 /**
  * @brief Process handler for sequence_transform feature.
  *
+ * @param engine sequence transform engine
  * @param keycode Keycode registered by matrix press, per keymap
  * @param record keyrecord_t structure
  * @param sequence_token_start starting keycode index for sequence tokens used in rules
  * @return true Continue processing keycodes, and send to host
  * @return false Stop processing keycodes, and don't send to host
  */
-bool process_sequence_transform(uint16_t keycode,
-                                keyrecord_t *record,
-                                uint16_t sequence_token_start)
+bool st_engine_process(st_engine_t *engine,
+                       uint16_t keycode,
+                       keyrecord_t *record,
+                       uint16_t sequence_token_start)
 {
 #if SEQUENCE_TRANSFORM_IDLE_TIMEOUT > 0
-    sequence_timer = timer_read32();
+    engine->sequence_timer = timer_read32();
 #endif
     uint8_t mods = get_mods();
 #ifndef NO_ACTION_ONESHOT
@@ -434,61 +896,84 @@ bool process_sequence_transform(uint16_t keycode,
 
     // Keycode verification and extraction
     const bool is_seq_tok = st_is_seq_token_keycode(keycode, sequence_token_start);
-    if (!is_seq_tok && !st_process_check(&keycode, record, &mods)) {
+    if (!is_seq_tok && !st_process_check(engine, &keycode, record, &mods)) {
         return true;
     }
     // Handle backspace
     if (keycode == KC_BSPC) {
-        st_on_backspace(record);
-        return true;
+        return st_on_backspace(engine, record);
     }
     // Don't process on key up
     if (!record->event.pressed) {
-        schedule_rule_search();
+#if SEQUENCE_TRANSFORM_RULE_SEARCH
+        schedule_rule_search(engine);
+#endif
         return true;
     }
     // if we can't process the keycode, reset the buffer and pass it along to the pipeline
     if (!is_seq_tok && !st_is_processable_keycode(keycode)) {
-        st_key_buffer_reset(&key_buffer);
+        st_engine_reset(engine);
         return true;
     }
     // Convert to triecode and add it to our buffer
     const uint8_t triecode = st_keycode_to_triecode(keycode, sequence_token_start);
     st_debug(ST_DBG_GENERAL, "  translated keycode: 0x%04X (%c)\n",
         keycode, st_triecode_to_ascii(triecode));
-    st_key_buffer_push(&key_buffer, triecode);
+    st_key_buffer_push(&engine->key_buffer, triecode);
     if (st_debug_check(ST_DBG_GENERAL)) {
-        st_key_buffer_print(&key_buffer);
+        st_key_buffer_print(&engine->key_buffer);
     }
     // Try to perform a sequence transform!
     bool st_perform_res;
-    st_log_time_with_result(st_perform(), &st_perform_res);
+    st_log_time_with_result(ST_LATENCY_PERFORM, st_perform(engine), &st_perform_res);
     if (st_perform_res) {
         // tell QMK to not process this key
         return false;
     }
     return true;
 }
+bool process_sequence_transform(uint16_t keycode,
+                                keyrecord_t *record,
+                                uint16_t sequence_token_start)
+{
+    return st_engine_process(engine_instance, keycode, record, sequence_token_start);
+}
 
 /**
  * @brief Performs sequence transform related actions that must occur after normal processing
  *
  * Should be called from the `post_process_record_user` function
+ *
+ * @param engine sequence transform engine
  */
-void post_process_sequence_transform()
+void st_engine_post_process(st_engine_t *engine)
 {
 #if SEQUENCE_TRANSFORM_ENHANCED_BACKSPACE
-    if (post_process_do_enhanced_backspace) {
+    if (engine->post_process_do_enhanced_backspace) {
         // remove last key from the buffer
         //   and undo the action of that key
-        st_log_time(st_handle_backspace());
-        post_process_do_enhanced_backspace = false;
+        st_log_time(ST_LATENCY_BACKSPACE, st_handle_backspace(engine));
+        engine->post_process_do_enhanced_backspace = false;
     }
 #endif
 #if SEQUENCE_TRANSFORM_RULE_SEARCH
-    if (post_process_do_rule_search) {
-        st_log_time(st_find_missed_rule());
-        post_process_do_rule_search = false;
+    if (engine->post_process_do_rule_search) {
+        st_log_time(ST_LATENCY_RULE_SEARCH, st_find_missed_rule(engine));
+        engine->post_process_do_rule_search = false;
     }
 #endif
 }
+void post_process_sequence_transform()
+{
+    st_engine_post_process(engine_instance);
+}
+#if SEQUENCE_TRANSFORM_LATENCY_HISTOGRAMS
+//////////////////////////////////////////////////////////////////////
+// Prints the latency histograms of all engines, and starts new ones.
+// Call it from a custom keycode to collect them from the console.
+void sequence_transform_dump_latency(void)
+{
+    st_latency_dump();
+    st_latency_reset();
+}
+#endif
@@ -16,33 +16,108 @@
 #include "key_stack.h"
 #include "trie.h"
 #include "cursor.h"
+#include "no_match_cache.h"
+#include "undo_journal.h"
 
 //////////////////////////////////////////////////////////////////
 // Public API
 
+// Net output of a run of keys fed with st_engine_feed_keys
+// (or undone with st_engine_undo):
+// delete `backspaces` chars that were output before the run,
+// then type the triecodes in `output` (oldest first)
+typedef struct
+{
+    st_key_stack_t          output;             // caller provided storage
+    int                     backspaces;
+    int                     transforms;         // keys of the run that performed a rule
+} st_feed_batch_t;
+
+// All the state of one sequence transform instance.
+// Buffers are statically allocated by whoever defines the engine
+// (see `engine` in sequence_transform.c), and sized for its trie.
+typedef struct
+{
+    const st_trie_t * const trie;               // dictionary to match against
+    st_key_buffer_t         key_buffer;         // history of keys and actions taken
+    st_key_stack_t          trie_stack;         // key stack used for searches
+    st_cursor_t             trie_cursor;        // cursor over key_buffer
+    st_feed_batch_t         *feed_batch;        // collects output while feeding keys
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+    st_no_match_cache_t     no_match_cache;     // recent key contexts with no match
+#endif
+#if SEQUENCE_TRANSFORM_IDLE_TIMEOUT > 0
+    uint32_t                sequence_timer;     // time of last key press
+#endif
+#if SEQUENCE_TRANSFORM_ENHANCED_BACKSPACE
+    uint32_t                backspace_timer;    // track backspace hold time
+    bool                    post_process_do_enhanced_backspace;
+#endif
+#if SEQUENCE_TRANSFORM_BACKSPACE_REPEAT > 0
+    bool                    backspace_held;     // repeated by st_engine_task
+    bool                    backspace_repeating;// held past the tapping term
+#endif
+#if SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE > 0
+    st_undo_journal_t       undo_journal;       // edits of recent rule actions
+#endif
+#if SEQUENCE_TRANSFORM_RULE_SEARCH
+    bool                    post_process_do_rule_search;
+#endif
+} st_engine_t;
+
+// Single instance QMK API, using the default engine
 bool process_sequence_transform(uint16_t keycode, keyrecord_t *record, uint16_t sequence_token_start);
 void sequence_transform_on_missed_rule_user(const st_trie_rule_t *rule);
 void post_process_sequence_transform(void);
 uint16_t sequence_transform_past_keycode(int index);
+int st_feed_keys(const uint8_t *triecodes, int n);
+#if SEQUENCE_TRANSFORM_ENHANCED_BACKSPACE
+int st_undo(int n);
+#endif
 
-#if SEQUENCE_TRANSFORM_IDLE_TIMEOUT > 0
+#if SEQUENCE_TRANSFORM_IDLE_TIMEOUT > 0 || SEQUENCE_TRANSFORM_BACKSPACE_REPEAT > 0
 void sequence_transform_task(void);
 #else
 static inline void sequence_transform_task(void) {}
 #endif
+#if SEQUENCE_TRANSFORM_LATENCY_HISTOGRAMS
+void sequence_transform_dump_latency(void);
+#else
+static inline void sequence_transform_dump_latency(void) {}
+#endif
+
+// Same API for a given engine
+st_engine_t *st_get_engine(void);
+bool st_engine_process(st_engine_t *engine, uint16_t keycode, keyrecord_t *record, uint16_t sequence_token_start);
+void st_engine_post_process(st_engine_t *engine);
+uint16_t st_engine_past_keycode(const st_engine_t *engine, int index);
+void st_engine_reset(st_engine_t *engine);
+int st_engine_feed_keys(st_engine_t *engine, const uint8_t *triecodes, int n, st_feed_batch_t *batch);
+#if SEQUENCE_TRANSFORM_ENHANCED_BACKSPACE
+int st_engine_undo(st_engine_t *engine, int n, st_feed_batch_t *batch);
+#endif
+#if SEQUENCE_TRANSFORM_IDLE_TIMEOUT > 0 || SEQUENCE_TRANSFORM_BACKSPACE_REPEAT > 0
+void st_engine_task(st_engine_t *engine);
+#endif
+#if defined(ST_TESTER) || defined(ST_HOST)
+void st_set_engine(st_engine_t *engine);
+#endif
 
 //////////////////////////////////////////////////////////////////
 // Internal
 
-bool st_process_check(uint16_t *keycode, const keyrecord_t *record, uint8_t *mods);
+bool st_process_check(st_engine_t *engine, uint16_t *keycode, const keyrecord_t *record, uint8_t *mods);
 void st_handle_repeat_key(void);
-void st_handle_result(const st_trie_t *trie, const st_trie_search_result_t *res);
-bool st_perform(void);
-void st_find_missed_rule(void);
-void st_handle_backspace(void);
+void st_handle_result(st_engine_t *engine, const st_trie_search_result_t *res);
+bool st_perform(st_engine_t *engine);
+void st_find_missed_rule(st_engine_t *engine);
+void st_handle_backspace(st_engine_t *engine);
 
 #ifdef ST_TESTER
 const st_trie_t *st_get_trie(void);
 st_key_buffer_t *st_get_key_buffer(void);
 st_cursor_t     *st_get_cursor(void);
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+st_no_match_cache_t *st_get_no_match_cache(void);
+#endif
 #endif
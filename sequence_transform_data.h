@@ -0,0 +1,1048 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was generated from rules with content hash 4f5dd5a675add501.
+// Do not edit this file directly!
+
+#pragma once
+
+#define SEQUENCE_TRANSFORM_GENERATOR_VERSION_3_4
+
+#define TRIECODE_SEQUENCE_TOKEN_0 0x0080
+#define TRIECODE_SEQUENCE_METACHAR_0 0x00A0
+#define TRIECODE_SEQUENCE_REF_TOKEN_0 0x0080
+#define SEQUENCE_MIN_LENGTH 2 // "∀👍"
+#define SEQUENCE_MAX_LENGTH 7 // "‸s👍q⎵o‸"
+#define TRANSFORM_MAX_LENGTH 20 // "‸sequence⎵transform◯"
+#define COMPLETION_MAX_LENGTH 11
+#define MAX_BACKSPACES 5
+#define SEQUENCE_TRIE_SIZE 3073
+#define SEQUENCE_TRIE_ALIGNED_SIZE 3294
+#define TRIE_PAYLOADS_SIZE 0
+#define TRIE_PAYLOAD_INDEX_SIZE 0
+#define COMPLETIONS_SIZE 869
+#define COMPLETIONS_HUFFMAN_SIZE 483
+#define COMPLETION_CODE_MAX_LENGTH 10
+#define COMPLETION_CODE_SYMBOL_COUNT 40
+#define COMPLETION_CHECKPOINT_INTERVAL 16
+#define COMPLETION_CHECKPOINT_COUNT 55
+#define TRIGGER_PAIR_ROWS_SIZE 192
+#define TRIE_MULTI_BRANCH_MAX_DEPTH 3
+#define SEQUENCE_TOKEN_COUNT 4
+#define SEQUENCE_METACHAR_COUNT 8
+#define SEQUENCE_REF_TOKEN_COUNT 8
+
+static const char st_seq_token_ascii_chars[] = { '*', '@', '#', '&' };
+static const char st_seq_metachar_ascii_chars[] = { 'U', 'A', 'D', 'T', 'N', 'P', '^', '~' };
+#ifdef ST_TESTER
+static const char *st_seq_tokens[] = { "👆", "👍", "★", "✪" };
+static const char *st_seq_metachars[] = { "∆", "∇", "∂", "‼", "‥", "•", "‸", "∀" };
+static const char *st_trans_seq_ref_tokens[] = { "◯", "⑴", "⑵", "⑶", "⑷", "⑸", "⑹", "⑺" };
+static const char *st_space_token = "⎵";
+#endif
+
+// Sequence Transformation dictionary with longest match semantics
+// Dictionary (436 entries):
+//    ∀👍      -> ∀⑴
+//    ∂👆      -> ∂.
+//    ∂n      -> ∂n
+//    ∂👍      -> ∂⑴
+//    qa      -> qua
+//    qi      -> qui
+//    qe      -> que
+//    qo      -> quo
+//    d★      -> develop
+//    ‸n      -> ‸th
+//    ‸👆      -> ‸n
+//    v👆      -> ver
+//    s👆      -> sk
+//    x👆      -> xes
+//    m👆      -> ment
+//    t👆      -> tment
+//    k👆      -> ks
+//    l👆      -> lk
+//    r👆      -> rl
+//    j👆      -> just
+//    c👆      -> cy
+//    p👆      -> py
+//    d👆      -> dy
+//    y👆      -> yp
+//    g👆      -> gy
+//    w👆      -> way
+//    q👆      -> quest
+//    b👆      -> before
+//    f👆      -> first
+//    z👆      -> zone
+//    n👆      -> nion
+//    h👆      -> however
+//    u👆      -> ue
+//    e👆      -> eu
+//    o👆      -> oa
+//    a👆      -> ao
+//    ,👆      -> ,⎵but
+//    i👆      -> ion
+//    .👆      -> .\ [escape]
+//    -👆      -> ->
+//    =👆      -> =>
+//    ‸👍      -> ‸for
+//    a👍      -> and
+//    x👍      -> xer
+//    k👍      -> know
+//    i👍      -> ing
+//    y👍      -> you
+//    q👍      -> quick
+//    j👍      -> join
+//    c👍      -> ck
+//    n👍      -> nf
+//    h👍      -> hn
+//    ‥👍      -> ‥⎵and
+//    ‼👍      -> ‼⎵⇑
+//    ∂∂👍     -> ∂∂⑴
+//    gh👍     -> ghly
+//    ‸k👍     -> ‸know
+//    ‸qa     -> ‸qua
+//    qa👆     -> qa
+//    qi👆     -> qi
+//    qe👆     -> qe
+//    qo👆     -> qo
+//    qm👆     -> qmk
+//    d★t     -> development
+//    d★r     -> developer
+//    d★d     -> developed
+//    ‸i👍     -> ‸i
+//    ‸c👍     -> ‸come
+//    ‸r👍     -> ‸right
+//    ‸l👍     -> ‸like
+//    ‸m👍     -> ‸make
+//    ‸n∀     -> ‸the◯
+//    ‸ne     -> ‸the
+//    ‸n👆     -> ‸then
+//    ‸nr     -> ‸th
+//    ‸ni     -> ‸their
+//    ‸ng     -> ‸thing
+//    ‸nk     -> ‸think
+//    ‸ny     -> ‸they
+//    ‸nd     -> ‸they'd
+//    ‸ns     -> ‸th
+//    ‸nt     -> ‸that
+//    ‸na     -> ‸tha
+//    ‸no     -> ‸tho
+//    ‸n👍     -> ‸through
+//    ‸t👍     -> ‸t
+//    ‸t👆     -> ‸tell
+//    k👍d     -> knowledge
+//    ‸k👆     -> ‸keep
+//    ‸o👍     -> ‸one
+//    ou👍     -> ough
+//    au👍     -> augh
+//    st👍     -> sts
+//    rs👍     -> rst
+//    ‸b👍     -> ‸be
+//    ‸f👍     -> ‸from
+//    ‸👆👍     -> ‸not
+//    ‸e👍     -> ‸each
+//    ‸w👍     -> ‸why
+//    ‸w👆     -> ‸way
+//    ‸v👍     -> ‸view
+//    ‸a👆     -> ‸abo
+//    ‸a👍     -> ‸and
+//    ‸s👍     -> ‸s
+//    ‸s👆     -> ‸sk
+//    s👆l     -> school
+//    ‸p👍     -> ‸pro
+//    ‸p👆     -> ‸py
+//    ‸d👍     -> ‸do
+//    ‸u👍     -> ‸use
+//    ‸h👍     -> ‸have
+//    ‸g👍     -> ‸give
+//    ‸y👍     -> ‸you
+//    ‸l👆     -> ‸little
+//    v👆👆     -> vern
+//    ma👆     -> make
+//    mr👆     -> mark
+//    ta👆     -> take
+//    li👆     -> list
+//    r👆👆     -> rln
+//    j👆👆     -> justment
+//    ‸j👍     -> ‸join
+//    c👆👆     -> cyn
+//    p👆👆     -> pyn
+//    pl👆     -> ply
+//    pa👆     -> page
+//    d👆👆     -> dyn
+//    da👆     -> day
+//    dr👆     -> dry
+//    y👆👆     -> ypn
+//    g👆👆     -> gyn
+//    q👆👆     -> question
+//    q👆d     -> quested
+//    u👆👆     -> uen
+//    e👆👆     -> eun
+//    ∂∂👍d    -> 2024-04-⑶⑵
+//    ‸s👍q    -> ‸sequence
+//    ‸t👍o    -> ‸transform
+//    ‸s👍l    -> ‸symbol
+//    ‸k👍r    -> ‸keypress
+//    ‸k👍b    -> ‸key_buffer
+//    ‸qa👆    -> ‸qa
+//    sim👆    -> simultaneously
+//    ‸i👍‸    -> ‸I◯
+//    ‸i👍m    -> ‸I'm
+//    ‸i👍d    -> ‸I'd
+//    ‸i👍l    -> ‸I'll
+//    ‸i👍v    -> ‸I've
+//    ‸i👍t    -> ‸isn't
+//    ‸i👍s    -> ‸increase
+//    ‸i👍e    -> ‸include
+//    ‸i👍r    -> ‸interest
+//    ‸c👍i    -> ‸coming
+//    ‸c👍r    -> ‸crowd
+//    ‸c👍t    -> ‸can't
+//    ‸c👍v    -> ‸cover
+//    ‸c👍o    -> ‸course
+//    ‸c👍a    -> ‸change
+//    ‸c👍e    -> ‸cause
+//    ‸c👍n    -> ‸consider
+//    ‸c👍m    -> ‸complete
+//    ‸c👍l    -> ‸call
+//    ‸c👍h    -> ‸child
+//    ‸c👍u    -> ‸could
+//    ‸w👍u    -> ‸would
+//    ‸s👍u    -> ‸should
+//    ‸r👍d    -> ‸round
+//    ‸r👍y    -> ‸ready
+//    ‸r👍i    -> ‸river
+//    ‸r👍e    -> ‸real
+//    ‸r👍m    -> ‸remember
+//    ‸r👍c    -> ‸record
+//    ‸r👍h    -> ‸reach
+//    ‸l👍g    -> ‸liking
+//    ‸l👍i    -> ‸light
+//    ‸l👍a    -> ‸large
+//    ‸l👍o    -> ‸look
+//    ‸l👍f    -> ‸life
+//    ‸l👍t    -> ‸last
+//    ‸l👍n    -> ‸line
+//    ‸l👍v    -> ‸leave
+//    ‸m👍g    -> ‸making
+//    ‸m👍i    -> ‸might
+//    ‸m👍o    -> ‸most
+//    ‸m👍e    -> ‸more
+//    ‸m👍u    -> ‸must
+//    ‸m👍c    -> ‸much
+//    ‸m👍v    -> ‸move
+//    ‸m👍n    -> ‸mean
+//    ‸m👍r    -> ‸mother
+//    ‸nrm    -> ‸therm
+//    ‸nr∀    -> ‸thr◯
+//    ‸nr‸    -> ‸there◯
+//    ‸nrs    -> ‸there's
+//    ‸nin    -> ‸thin
+//    ‸nyr    -> ‸they're
+//    ‸nyl    -> ‸they'll
+//    ‸ns‸    -> ‸this◯
+//    ‸nse    -> ‸these
+//    ‸nts    -> ‸that's
+//    ‸na‸    -> ‸than◯
+//    ‸nak    -> ‸thank
+//    ‸no‸    -> ‸those◯
+//    ‸nou    -> ‸though
+//    ‸not    -> ‸thought
+//    ‸nor    -> ‸thorough
+//    ‸t👍‸    -> ‸time◯
+//    ‸t👍g    -> ‸though
+//    ‸t👍t    -> ‸thought
+//    ‸t👍r    -> ‸through
+//    ‸t👍n    -> ‸techn
+//    ‸t👍w    -> ‸throw
+//    ‸t👍a    -> ‸take
+//    k👍di    -> knowledging
+//    k👍dd    -> knowledged
+//    ‸k👍d    -> ‸knowledge
+//    ‸o👍x    -> ‸oxygen
+//    ‸o👍r    -> ‸other
+//    ‸o👍t    -> ‸often
+//    ‸o👍b    -> ‸object
+//    ‸o👍v    -> ‸observe
+//    ‸o👍p    -> ‸opposite
+//    ‸o👍g    -> ‸original
+//    ‸o👍c    -> ‸occur
+//    ‸o👍f    -> ‸offer
+//    ‸o👍d    -> ‸order
+//    ‸b👍o    -> ‸both
+//    ‸b👍s    -> ‸because
+//    ‸b👍c    -> ‸become
+//    ‸b👍t    -> ‸between
+//    ‸b👍k    -> ‸back
+//    ‸b👍g    -> ‸begin
+//    ‸b👍l    -> ‸believe
+//    ‸b👍e    -> ‸been
+//    ‸b👍r    -> ‸brother
+//    ‸b👍u    -> ‸buffer
+//    ‸f👍l    -> ‸follow
+//    ‸f👍r    -> ‸friend
+//    ‸f👍d    -> ‸find
+//    ‸f👍e    -> ‸feel
+//    ‸f👍c    -> ‸face
+//    ‸f👍t    -> ‸fact
+//    ‸👆👍v    -> ‸never
+//    ‸👆👍t    -> ‸nation
+//    ‸👆👍d    -> ‸need
+//    ‸👆👍w    -> ‸nowhere
+//    ‸👆👍g    -> ‸nothing
+//    ‸👆👍m    -> ‸number
+//    ‸👆👍r    -> ‸neighbor
+//    ‸e👍g    -> ‸enough
+//    ‸e👍n    -> ‸even
+//    ‸e👍y    -> ‸every
+//    ‸e👍r    -> ‸early
+//    ‸e👍x    -> ‸example
+//    ‸e👍c    -> ‸exercise
+//    ‸e👍p    -> ‸expert
+//    ‸e👍q    -> ‸equal
+//    ‸w👍i    -> ‸which
+//    ‸w👍n    -> ‸when
+//    ‸w👍h    -> ‸while
+//    ‸w👍e    -> ‸where
+//    ‸w👍a    -> ‸what
+//    ‸w👍t    -> ‸won't
+//    ‸w👍o    -> ‸world
+//    ‸w👍k    -> ‸work
+//    ‸w👍r    -> ‸we're
+//    ‸w👍d    -> ‸we'd
+//    ‸w👍l    -> ‸we'll
+//    ‸w👍v    -> ‸we've
+//    ‸w👆👆    -> ‸wayn
+//    ‸w👆i    -> ‸will
+//    ‸w👆e    -> ‸well
+//    ‸w👆r    -> ‸write
+//    ‸w👆o    -> ‸word
+//    ‸w👆t    -> ‸with
+//    ‸v👍g    -> ‸viewing
+//    ‸v👍r    -> ‸viewer
+//    ‸v👍d    -> ‸viewed
+//    ‸v👍i    -> ‸vision
+//    ‸v👍n    -> ‸version
+//    ‸a👆t    -> ‸about
+//    ‸a👆v    -> ‸above
+//    ‸a👆d    -> ‸aboard
+//    ‸a👆s    -> ‸absolute
+//    ‸a👆l    -> ‸also
+//    ‸a👍r    -> ‸after
+//    ‸a👍👆    -> ‸another
+//    ‸a👍d    -> ‸around
+//    ‸a👍n    -> ‸again
+//    ‸a👍t    -> ‸against
+//    ‸a👍s    -> ‸answer
+//    ‸a👍p    -> ‸appear
+//    ‸a👍w    -> ‸always
+//    ‸a👍y    -> ‸already
+//    ‸a👍l    -> ‸alright
+//    ‸s👍∀    -> ‸some◯
+//    ‸s👍t    -> ‸sometimes
+//    ‸s👍g    -> ‸something
+//    ‸s👍h    -> ‸somehow
+//    ‸s👍w    -> ‸somewhere
+//    ‸s👍o    -> ‸someone
+//    ‸s👍y    -> ‸system
+//    ‸s👍d    -> ‸sound
+//    ‸s👍c    -> ‸science
+//    ‸s👍s    -> ‸success
+//    ‸s👍m    -> ‸small
+//    ‸s👍p    -> ‸special
+//    ‸s👍a    -> ‸state
+//    ‸s👍e    -> ‸she
+//    ‸s👍i    -> ‸still
+//    ‸s👍n    -> ‸since
+//    ‸s👆c    -> ‸such
+//    ‸s👆l    -> ‸school
+//    ‸p👍b    -> ‸problem
+//    ‸p👍m    -> ‸program
+//    ‸p👍r    -> ‸present
+//    ‸p👍e    -> ‸people
+//    ‸p👍a    -> ‸play
+//    ‸p👍s    -> ‸possible
+//    ‸p👍n    -> ‸person
+//    ‸p👍o    -> ‸power
+//    ‸p👍u    -> ‸public
+//    ‸p👍h    -> ‸psych
+//    ‸p👍l    -> ‸place
+//    ‸p👍t    -> ‸point
+//    ‸p👆👆    -> ‸pyn
+//    ‸p👆a    -> ‸probable
+//    ‸d👍t    -> ‸don't
+//    ‸d👍i    -> ‸did
+//    ‸d👍s    -> ‸does
+//    ‸d👍f    -> ‸differ
+//    ‸d👍u    -> ‸difficult
+//    ‸d👍r    -> ‸during
+//    ‸d👍n    -> ‸down
+//    ‸d👍d    -> ‸decide
+//    ‸d👍l    -> ‸develop
+//    ‸u👍i    -> ‸using
+//    ‸u👍f    -> ‸useful
+//    ‸u👍r    -> ‸user
+//    ‸u👍t    -> ‸update
+//    ‸u👍g    -> ‸upgrade
+//    ‸u👍n    -> ‸under
+//    ‸h👍g    -> ‸having
+//    ‸h👍e    -> ‸he
+//    ‸h👍r    -> ‸here
+//    ‸h👍s    -> ‸house
+//    ‸h👍t    -> ‸haven't
+//    ‸h👍l    -> ‸help
+//    ‸h👍d    -> ‸had
+//    ‸g👍i    -> ‸giving
+//    ‸g👍v    -> ‸govern
+//    ‸g👍e    -> ‸general
+//    ‸g👍r    -> ‸group
+//    ‸g👍t    -> ‸great
+//    ‸g👍o    -> ‸good
+//    ‸g👍u    -> ‸guage
+//    ‸g👍a    -> ‸guarantee
+//    ‸y👍e    -> ‸you're
+//    ‸y👍l    -> ‸you'll
+//    ‸y👍v    -> ‸you've
+//    ‸y👍d    -> ‸you'd
+//    ‸y👍y    -> ‸yesterday
+//    ‸y👍o    -> ‸yellow
+//    ma👆g    -> making
+//    ta👆👆    -> taken
+//    ta👆g    -> taking
+//    lli👆    -> llion
+//    ‸j👍d    -> ‸judge
+//    ‸s👍qo   -> ‸sequence_transform
+//    ‸s👍q-   -> ‸sequence-transform
+//    ‸qua👆   -> ‸quali
+//    ‸qa👆t   -> ‸quality
+//    sim👆👆   -> simultaneous
+//    ‸i👍ts   -> ‸it's
+//    ‸i👍sg   -> ‸increasing
+//    ‸i👍eg   -> ‸including
+//    ‸i👍rg   -> ‸interesting
+//    ‸i👍rd   -> ‸interested
+//    ‸c👍ai   -> ‸changing
+//    ‸c👍ni   -> ‸considering
+//    ‸c👍mi   -> ‸completing
+//    ‸c👍hr   -> ‸children
+//    ‸s👍ur   -> ‸shoulder
+//    ‸c👍ut   -> ‸couldn't
+//    ‸w👍ut   -> ‸wouldn't
+//    ‸s👍ut   -> ‸shouldn't
+//    ‸c👍uv   -> ‸could've
+//    ‸w👍uv   -> ‸would've
+//    ‸s👍uv   -> ‸should've
+//    ‸r👍ey   -> ‸really
+//    ‸r👍st   -> ‸restaurant
+//    ‸l👍og   -> ‸looking
+//    ‸t👍ny   -> ‸technology
+//    ‸t👍nl   -> ‸technical
+//    ‸t👍nu   -> ‸technique
+//    ‸t👍ag   -> ‸taking
+//    ‸k👍di   -> ‸knowledging
+//    ‸k👍dd   -> ‸knowledged
+//    ‸o👍di   -> ‸ordering
+//    ‸b👍ka   -> ‸backspace
+//    ‸f👍l👆   -> ‸follower
+//    ‸f👍ld   -> ‸followed
+//    ‸e👍ym   -> ‸everytime
+//    ‸e👍yt   -> ‸everything
+//    ‸e👍qt   -> ‸equate
+//    ‸w👍ts   -> ‸what's
+//    ‸w👍rt   -> ‸weren't
+//    ‸w👆rn   -> ‸written
+//    ‸w👆ri   -> ‸writing
+//    ‸w👆ok   -> ‸wordbreak
+//    ‸w👆to   -> ‸without
+//    ‸a👍rt   -> ‸aren't
+//    ‸s👍es   -> ‸she's
+//    ‸s👍ed   -> ‸she'd
+//    ‸s👍el   -> ‸she'll
+//    ‸p👆ay   -> ‸probably
+//    ‸d👍it   -> ‸didn't
+//    ‸d👍st   -> ‸doesn't
+//    ‸d👍ft   -> ‸different
+//    ‸d👍lm   -> ‸development
+//    ‸d👍ld   -> ‸developed
+//    ‸d👍l👆   -> ‸developer
+//    ‸h👍es   -> ‸he's
+//    ‸h👍el   -> ‸he'll
+//    ‸h👍ed   -> ‸he'd
+//    ‸h👍st   -> ‸hasn't
+//    ‸h👍dt   -> ‸hadn't
+//    ‸g👍vd   -> ‸governed
+//    ‸g👍vm   -> ‸government
+//    vili👆   -> vilion
+//    ‸j👍dt   -> ‸judgment
+//    judge👆  -> judgment
+//    ‸t👍nly  -> ‸technically
+//    blivi👆  -> blivion
+//    ‸j👍dta  -> ‸judgmental
+//    ‸s👍q⎵o‸ -> ‸sequence⎵transform◯
+
+static const uint8_t sequence_transform_trie[SEQUENCE_TRIE_SIZE] PROGMEM = {
+    0x60, 0x2D, 0x00, 0x5F, 0x61, 0x00, 0x66, 0x62, 0x00, 0xB9, 0x63, 0x00, 0xCC, 0x64, 0x00, 0xFD,
+    0x65, 0x01, 0xA7, 0x66, 0x02, 0x0A, 0x67, 0x02, 0x23, 0x68, 0x02, 0x97, 0x69, 0x02, 0xB6, 0x6B,
+    0x03, 0x32, 0x6C, 0x03, 0x51, 0x6D, 0x03, 0xBF, 0x6E, 0x03, 0xFC, 0x6F, 0x04, 0x63, 0x70, 0x04,
+    0xC0, 0x71, 0x04, 0xD9, 0x72, 0x04, 0xE6, 0x73, 0x05, 0x7E, 0x74, 0x05, 0xD9, 0x75, 0x06, 0xB7,
+    0x76, 0x06, 0xF4, 0x77, 0x07, 0x43, 0x78, 0x07, 0x5C, 0x79, 0x07, 0x69, 0x80, 0x07, 0xA6, 0x81,
+    0x0A, 0x0C, 0x82, 0x0B, 0xAC, 0x83, 0x0B, 0xB9, 0xA6, 0x0B, 0xBE, 0xA7, 0x0B, 0xEE, 0x00, 0x81,
+    0x04, 0xE2, 0x00, 0x0A, 0x00, 0x0B, 0xCB, 0x03, 0x47, 0x00, 0x05, 0x01, 0xE1, 0x04, 0x5F, 0x00,
+    0x01, 0x00, 0x03, 0x05, 0xE3, 0x00, 0x02, 0x00, 0xB2, 0x09, 0xA2, 0x01, 0x07, 0x00, 0xB4, 0x0A,
+    0x97, 0x03, 0x05, 0x01, 0x8C, 0x0A, 0xB7, 0x03, 0x08, 0x00, 0x6D, 0x0A, 0xFD, 0x03, 0x04, 0x02,
+    0x1A, 0x0B, 0x1A, 0x02, 0x03, 0x03, 0x2E, 0x0B, 0x39, 0x00, 0x04, 0x02, 0xBE, 0x0B, 0x4B, 0x00,
+    0x03, 0x02, 0xF2, 0x0B, 0x75, 0x01, 0x02, 0x01, 0x4B, 0x01, 0x71, 0x00, 0xE0, 0x00, 0x02, 0x00,
+    0x6D, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x02, 0x00, 0x6D, 0x83, 0x0A, 0xF5, 0x03, 0x09, 0x00, 0x3C,
+    0x0B, 0x12, 0x02, 0x05, 0x01, 0x50, 0x0B, 0x1A, 0x00, 0x04, 0x02, 0x1E, 0x88, 0x09, 0xCB, 0x01,
+    0x03, 0x03, 0x4C, 0x0A, 0x8A, 0x00, 0x04, 0x02, 0x26, 0x0A, 0xA7, 0x03, 0x07, 0x00, 0xBB, 0x0A,
+    0xAF, 0x03, 0x03, 0x01, 0xE3, 0x0B, 0x05, 0x03, 0x03, 0x03, 0x4C, 0x0B, 0x12, 0x02, 0x04, 0x02,
+    0x22, 0x0B, 0x27, 0x04, 0x05, 0x01, 0x69, 0x0B, 0x39, 0x00, 0x06, 0x00, 0xC8, 0x90, 0x1C, 0x01,
+    0x6D, 0x00, 0x01, 0x00, 0x4A, 0x01, 0x73, 0x00, 0x01, 0x00, 0x4A, 0x01, 0xD4, 0x00, 0x02, 0x02,
+    0x48, 0x01, 0xF2, 0x00, 0x02, 0x02, 0x48, 0x03, 0x91, 0x00, 0x02, 0x01, 0xA6, 0x03, 0x97, 0x00,
+    0x02, 0x01, 0xA6, 0x04, 0x5F, 0x00, 0x04, 0x02, 0x46, 0x05, 0x44, 0x00, 0x02, 0x01, 0xA6, 0x07,
+    0x1B, 0x00, 0x02, 0x01, 0xA6, 0x08, 0xE9, 0x00, 0x03, 0x02, 0xF5, 0x09, 0xA7, 0x00, 0x02, 0x01,
+    0xA6, 0x0A, 0x19, 0x02, 0x03, 0x03, 0x04, 0x0A, 0x82, 0x02, 0x05, 0x01, 0xDC, 0x0A, 0x9F, 0x01,
+    0x05, 0x01, 0x64, 0x0A, 0xAF, 0x03, 0x03, 0x03, 0x1F, 0x0A, 0xCE, 0x02, 0x01, 0x00, 0x4A, 0x0A,
+    0xDB, 0x01, 0x03, 0x02, 0xE6, 0x0A, 0xE8, 0x03, 0x04, 0x02, 0xCA, 0x0A, 0xED, 0x00, 0x05, 0x01,
+    0xA5, 0x0A, 0xF5, 0x00, 0x05, 0x01, 0xA5, 0x0B, 0x12, 0x02, 0x04, 0x02, 0xA2, 0x0B, 0x27, 0x04,
+    0x04, 0x01, 0xDD, 0x0B, 0x39, 0x00, 0x04, 0x01, 0xDD, 0x0B, 0x6D, 0x00, 0x02, 0x01, 0xA6, 0x0B,
+    0x75, 0x02, 0x03, 0x02, 0xFE, 0x0B, 0x87, 0x00, 0x02, 0x02, 0x48, 0x0B, 0x94, 0x03, 0x0A, 0x00,
+    0x15, 0x0B, 0xB5, 0x00, 0x02, 0x01, 0xA6, 0xCF, 0x04, 0x5F, 0x00, 0x01, 0x00, 0x05, 0x05, 0x8D,
+    0x00, 0x03, 0x01, 0x87, 0x09, 0xEF, 0x02, 0x03, 0x01, 0x73, 0x0A, 0x8A, 0x00, 0x02, 0x00, 0x86,
+    0x0A, 0x97, 0x03, 0x04, 0x01, 0x5B, 0x0A, 0xAF, 0x03, 0x03, 0x01, 0x72, 0x0A, 0xB7, 0x03, 0x06,
+    0x00, 0xCE, 0x0A, 0xCE, 0x03, 0x01, 0x00, 0x05, 0x0A, 0xDB, 0x00, 0x06, 0x00, 0xFE, 0x0B, 0x05,
+    0x03, 0x03, 0x00, 0x7A, 0x0B, 0x1A, 0x02, 0x05, 0x01, 0x78, 0x0B, 0x27, 0x04, 0x03, 0x03, 0x01,
+    0x0B, 0x39, 0x00, 0x02, 0x00, 0x69, 0x0B, 0x75, 0x01, 0x03, 0x00, 0x43, 0x0B, 0x87, 0x00, 0x03,
+    0x02, 0x2F, 0x01, 0x71, 0x00, 0xA0, 0x00, 0x02, 0x00, 0x85, 0x84, 0x0A, 0x9F, 0x01, 0x05, 0x01,
+    0x9B, 0x0A, 0xFD, 0x02, 0x02, 0x00, 0x42, 0x0B, 0x12, 0x02, 0x04, 0x00, 0x41, 0x0B, 0x65, 0x00,
+    0x03, 0x03, 0x10, 0x90, 0x13, 0x00, 0x9F, 0x01, 0x03, 0x00, 0x5A, 0x01, 0xDA, 0x01, 0x03, 0x00,
+    0x5A, 0x04, 0x5F, 0x00, 0x03, 0x00, 0x5A, 0x04, 0x90, 0x00, 0x03, 0x00, 0x5A, 0x05, 0x44, 0x00,
+    0x03, 0x00, 0x5A, 0x05, 0xC9, 0x01, 0x03, 0x00, 0x5A, 0x08, 0xD1, 0x01, 0x03, 0x00, 0x5A, 0x08,
+    0xDB, 0x01, 0x03, 0x00, 0x5A, 0x0A, 0x19, 0x00, 0x04, 0x00, 0x59, 0x0A, 0x8A, 0x00, 0x03, 0x00,
+    0xAF, 0x0A, 0xA7, 0x03, 0x05, 0x01, 0xB4, 0x0A, 0xCE, 0x01, 0x03, 0x00, 0x5A, 0x0A, 0xFD, 0x01,
+    0x03, 0x00, 0x5A, 0x0B, 0x05, 0x01, 0x03, 0x00, 0x5A, 0x0B, 0x12, 0x02, 0x07, 0x00, 0xAD, 0x0B,
+    0x39, 0x00, 0x08, 0x00, 0x55, 0x0B, 0x4B, 0x00, 0x05, 0x00, 0xE6, 0x0B, 0x65, 0x02, 0x06, 0x01,
+    0x22, 0x0B, 0x6D, 0x00, 0x03, 0x00, 0x5A, 0x85, 0x0A, 0x97, 0x03, 0x04, 0x02, 0x56, 0x0B, 0x1A,
+    0x02, 0x04, 0x02, 0xBA, 0x0B, 0x27, 0x04, 0x04, 0x02, 0x36, 0x0B, 0x39, 0x00, 0x06, 0x01, 0x0A,
+    0x0B, 0x75, 0x01, 0x03, 0x03, 0x1C, 0xD0, 0x13, 0x00, 0x81, 0x01, 0x03, 0x00, 0x5A, 0x01, 0x6D,
+    0x01, 0x03, 0x00, 0x5A, 0x01, 0x73, 0x01, 0x03, 0x00, 0x5A, 0x01, 0x79, 0x00, 0x03, 0x00, 0x5A,
+    0x03, 0xE0, 0x01, 0x03, 0x00, 0x5A, 0x04, 0x11, 0x00, 0x03, 0x00, 0x5A, 0x04, 0x5F, 0x00, 0x03,
+    0x02, 0x71, 0x05, 0x08, 0x01, 0x03, 0x00, 0x5A, 0x09, 0xEF, 0x02, 0x03, 0x02, 0xC3, 0x0A, 0x97,
+    0x01, 0x03, 0x00, 0x5A, 0x0A, 0x9F, 0x01, 0x02, 0x01, 0x06, 0x0A, 0xB7, 0x01, 0x03, 0x00, 0x5A,
+    0x0A, 0xFD, 0x02, 0x03, 0x00, 0xE9, 0x0B, 0x05, 0x03, 0x04, 0x00, 0xFA, 0x0B, 0x27, 0x03, 0x03,
+    0x01, 0x19, 0x0B, 0x39, 0x00, 0x04, 0x02, 0xC2, 0x0B, 0x65, 0x01, 0x03, 0x00, 0x5A, 0x0B, 0x6D,
+    0x02, 0x04, 0x00, 0xD6, 0x0B, 0x75, 0x01, 0x03, 0x03, 0x13, 0x01, 0x71, 0x00, 0xA0, 0x00, 0x02,
+    0x02, 0xD2, 0x85, 0x00, 0x6F, 0x00, 0x02, 0x03, 0x23, 0x04, 0x5F, 0x00, 0x03, 0x03, 0x22, 0x04,
+    0x78, 0x00, 0x05, 0x01, 0x55, 0x0A, 0x8A, 0x01, 0x03, 0x02, 0xEC, 0x0B, 0x75, 0x02, 0x03, 0x03,
+    0x3D, 0x90, 0x12, 0x01, 0xD4, 0x00, 0x03, 0x02, 0x0F, 0x01, 0xF2, 0x00, 0x03, 0x02, 0x0F, 0x04,
+    0x3B, 0x00, 0x04, 0x02, 0x5E, 0x07, 0x84, 0x00, 0x03, 0x02, 0x0F, 0x08, 0xE9, 0x02, 0x03, 0x03,
+    0x31, 0x09, 0xC3, 0x01, 0x05, 0x01, 0x5F, 0x09, 0xCB, 0x01, 0x05, 0x01, 0x5F, 0x0A, 0x82, 0x02,
+    0x06, 0x00, 0xF8, 0x0A, 0x8A, 0x00, 0x05, 0x01, 0xAA, 0x0A, 0x97, 0x03, 0x03, 0x02, 0x7B, 0x0A,
+    0x9F, 0x01, 0x06, 0x00, 0xDA, 0x0A, 0xAF, 0x03, 0x05, 0x01, 0xB9, 0x0A, 0xCE, 0x03, 0x03, 0x03,
+    0x0A, 0x0A, 0xDB, 0x01, 0x04, 0x02, 0x0E, 0x0B, 0x1A, 0x02, 0x04, 0x02, 0x76, 0x0B, 0x39, 0x00,
+    0x05, 0x02, 0x04, 0x0B, 0x75, 0x02, 0x04, 0x02, 0x2A, 0x0B, 0x87, 0x00, 0x03, 0x02, 0x0F, 0x8A,
+    0x03, 0x91, 0x00, 0x04, 0x02, 0x7E, 0x04, 0xF0, 0x00, 0x03, 0x03, 0x0D, 0x07, 0x1B, 0x00, 0x04,
+    0x02, 0x7E, 0x07, 0x90, 0x00, 0x04, 0x00, 0x60, 0x0A, 0x19, 0x02, 0x05, 0x01, 0xF0, 0x0A, 0x97,
+    0x01, 0x05, 0x01, 0xCD, 0x0A, 0xDB, 0x01, 0x03, 0x02, 0xE9, 0x0B, 0x1A, 0x00, 0x04, 0x02, 0x52,
+    0x0B, 0x27, 0x04, 0x07, 0x00, 0x7C, 0x0B, 0x39, 0x00, 0x04, 0x02, 0x7A, 0xCE, 0x02, 0xDE, 0x03,
+    0x02, 0x00, 0x5A, 0x05, 0x08, 0x01, 0x03, 0x02, 0x4B, 0x0A, 0x82, 0x02, 0x04, 0x00, 0xE0, 0x0A,
+    0x97, 0x02, 0x06, 0x01, 0x04, 0x0A, 0x9F, 0x00, 0x02, 0x03, 0x5F, 0x0A, 0xA7, 0x03, 0x03, 0x03,
+    0x52, 0x0A, 0xFD, 0x02, 0x02, 0x00, 0x04, 0x0B, 0x05, 0x03, 0x03, 0x02, 0x15, 0x0B, 0x1A, 0x02,
+    0x05, 0x01, 0x82, 0x0B, 0x39, 0x00, 0x04, 0x02, 0x6A, 0x0B, 0x4B, 0x00, 0x04, 0x02, 0x3E, 0x0B,
+    0x65, 0x02, 0x04, 0x02, 0x82, 0x0B, 0x6D, 0x03, 0x06, 0x00, 0xD4, 0x0B, 0x75, 0x01, 0x02, 0x00,
+    0x86, 0x60, 0xA2, 0x04, 0x59, 0xA6, 0x04, 0x5E, 0x00, 0xA0, 0x00, 0x01, 0x00, 0x04, 0xA0, 0x00,
+    0x02, 0x00, 0x58, 0xCE, 0x04, 0x5F, 0x00, 0x01, 0x00, 0x06, 0x04, 0xE2, 0x00, 0x0A, 0x00, 0x1F,
+    0x06, 0x43, 0x00, 0x03, 0x03, 0x43, 0x09, 0xEF, 0x02, 0x03, 0x01, 0x6B, 0x0A, 0x8A, 0x01, 0x03,
+    0x01, 0x29, 0x0A, 0x97, 0x02, 0x04, 0x02, 0xD6, 0x0A, 0xB7, 0x03, 0x03, 0x03, 0x37, 0x0A, 0xFD,
+    0x03, 0x03, 0x03, 0x3A, 0x0B, 0x05, 0x03, 0x03, 0x03, 0x40, 0x0B, 0x1A, 0x02, 0x04, 0x02, 0x9A,
+    0x0B, 0x39, 0x00, 0x06, 0x01, 0x10, 0x0B, 0x4B, 0x00, 0x08, 0x00, 0x0D, 0x0B, 0x75, 0x02, 0x04,
+    0x02, 0x92, 0x0B, 0x87, 0x02, 0x05, 0x01, 0x73, 0x01, 0x71, 0x00, 0xA0, 0x00, 0x02, 0x03, 0x5D,
+    0x84, 0x0A, 0x82, 0x02, 0x05, 0x01, 0xD2, 0x0A, 0xA7, 0x03, 0x05, 0x01, 0xFA, 0x0B, 0x12, 0x02,
+    0x07, 0x00, 0xA6, 0x0B, 0x39, 0x00, 0x06, 0x01, 0x1C, 0x82, 0x0A, 0xA7, 0x03, 0x04, 0x02, 0x9E,
+    0x0B, 0x39, 0x00, 0x07, 0x00, 0x83, 0x90, 0x19, 0x02, 0x9A, 0x00, 0x03, 0x01, 0xD7, 0x04, 0x5F,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x66, 0x00, 0x05, 0x00, 0xED, 0x06, 0xEA, 0x00, 0x02, 0x00, 0x43,
+    0x07, 0x84, 0x00, 0x03, 0x02, 0x2F, 0x09, 0xEF, 0x02, 0x04, 0x02, 0xAA, 0x0A, 0x19, 0x02, 0x07,
+    0x00, 0x75, 0x0A, 0x82, 0x02, 0x04, 0x02, 0x4E, 0x0A, 0x8A, 0x01, 0x06, 0x01, 0x28, 0x0A, 0x97,
+    0x03, 0x04, 0x02, 0xB2, 0x0A, 0x9F, 0x01, 0x05, 0x01, 0xF5, 0x0A, 0xA7, 0x02, 0x03, 0x03, 0x46,
+    0x0A, 0xAF, 0x02, 0x04, 0x02, 0x62, 0x0A, 0xB7, 0x03, 0x04, 0x02, 0xAE, 0x0A, 0xCE, 0x03, 0x03,
+    0x00, 0x43, 0x0A, 0xDB, 0x00, 0x07, 0x00, 0x98, 0x0A, 0xF5, 0x03, 0x07, 0x00, 0x8A, 0x0B, 0x05,
+    0x03, 0x05, 0x01, 0x29, 0x0B, 0x12, 0x02, 0x04, 0x01, 0x2A, 0x0B, 0x1A, 0x01, 0x05, 0x01, 0x87,
+    0x0B, 0x4B, 0x00, 0x06, 0x00, 0xEC, 0x0B, 0x65, 0x00, 0x01, 0x00, 0x0D, 0x0B, 0x6D, 0x00, 0x02,
+    0x00, 0x43, 0x0B, 0x75, 0x02, 0x04, 0x02, 0x2E, 0x0B, 0xB5, 0x00, 0x02, 0x00, 0x43, 0x8F, 0x01,
+    0xD4, 0x00, 0x02, 0x01, 0x80, 0x01, 0xF2, 0x00, 0x02, 0x01, 0x80, 0x04, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xF0, 0x00, 0x05, 0x01, 0x7D, 0x05, 0xF5, 0x00, 0x02, 0x01, 0x80, 0x06, 0x79, 0x04,
+    0x03, 0x01, 0x93, 0x06, 0xA3, 0x04, 0x05, 0x01, 0x91, 0x08, 0xE9, 0x01, 0x06, 0x01, 0x2E, 0x0A,
+    0x82, 0x01, 0x04, 0x02, 0xB6, 0x0A, 0x8A, 0x00, 0x05, 0x01, 0x5A, 0x0A, 0x9F, 0x00, 0x02, 0x00,
+    0x33, 0x0A, 0xCE, 0x03, 0x04, 0x02, 0x96, 0x0A, 0xDB, 0x00, 0x07, 0x00, 0x91, 0x0B, 0x1A, 0x02,
+    0x07, 0x00, 0x9F, 0x0B, 0x39, 0x00, 0x06, 0x01, 0x3A, 0xD0, 0x23, 0x01, 0x5B, 0x00, 0x03, 0x01,
+    0x48, 0x01, 0x67, 0x01, 0x04, 0x02, 0x7E, 0x02, 0x0D, 0x00, 0x03, 0x00, 0x97, 0x02, 0xF6, 0x00,
+    0x03, 0x01, 0x48, 0x04, 0x5F, 0x00, 0x02, 0x01, 0x4B, 0x04, 0x66, 0x00, 0x04, 0x00, 0xE8, 0x04,
+    0xDC, 0x01, 0x02, 0x00, 0x3B, 0x05, 0x14, 0x04, 0x05, 0x01, 0xD7, 0x05, 0x74, 0x03, 0x05, 0x01,
+    0xD7, 0x05, 0xBD, 0x00, 0x03, 0x01, 0x48, 0x05, 0xC3, 0x04, 0x05, 0x01, 0x46, 0x06, 0xCC, 0x00,
+    0x03, 0x01, 0x48, 0x06, 0xEA, 0x00, 0x03, 0x01, 0x48, 0x06, 0xF0, 0x00, 0x03, 0x01, 0x48, 0x07,
+    0x90, 0x00, 0x05, 0x00, 0x58, 0x07, 0xB4, 0x01, 0x06, 0x01, 0x34, 0x08, 0xE9, 0x00, 0x02, 0x01,
+    0x31, 0x09, 0xEF, 0x02, 0x03, 0x03, 0x28, 0x0A, 0x19, 0x02, 0x05, 0x01, 0x4B, 0x0A, 0x82, 0x02,
+    0x06, 0x00, 0xE0, 0x0A, 0x8A, 0x00, 0x05, 0x01, 0xE6, 0x0A, 0x97, 0x03, 0x04, 0x02, 0x16, 0x0A,
+    0x9F, 0x00, 0x03, 0x01, 0x48, 0x0A, 0xAF, 0x03, 0x03, 0x02, 0xEF, 0x0A, 0xB7, 0x03, 0x04, 0x02,
+    0xA6, 0x0A, 0xCE, 0x00, 0x03, 0x01, 0x48, 0x0A, 0xDB, 0x00, 0x04, 0x01, 0x47, 0x0A, 0xFD, 0x03,
+    0x03, 0x02, 0xFB, 0x0B, 0x12, 0x02, 0x04, 0x02, 0x4A, 0x0B, 0x1A, 0x02, 0x04, 0x02, 0x86, 0x0B,
+    0x39, 0x00, 0x08, 0x00, 0x5D, 0x0B, 0x4B, 0x00, 0x06, 0x00, 0xE6, 0x0B, 0x65, 0x02, 0x05, 0x01,
+    0xC8, 0x0B, 0x75, 0x02, 0x04, 0x02, 0x8E, 0x0B, 0xB5, 0x00, 0x04, 0x02, 0x7E, 0x01, 0x73, 0x00,
+    0x81, 0x0B, 0x27, 0x05, 0x09, 0x00, 0x33, 0x8A, 0x04, 0x3B, 0x00, 0x04, 0x02, 0x6E, 0x04, 0x66,
+    0x00, 0x03, 0x00, 0xE8, 0x0A, 0x8A, 0x01, 0x05, 0x00, 0x40, 0x0A, 0x97, 0x02, 0x03, 0x01, 0x98,
+    0x0A, 0x9F, 0x01, 0x08, 0x00, 0x4D, 0x0A, 0xB7, 0x03, 0x04, 0x02, 0xC6, 0x0B, 0x05, 0x03, 0x03,
+    0x03, 0x4F, 0x0B, 0x1A, 0x02, 0x05, 0x01, 0xEB, 0x0B, 0x39, 0x00, 0x05, 0x01, 0x96, 0x0B, 0x75,
+    0x02, 0x04, 0x01, 0x97, 0x8D, 0x06, 0xCC, 0x00, 0x03, 0x02, 0x13, 0x06, 0xEA, 0x00, 0x03, 0x02,
+    0x13, 0x06, 0xF0, 0x00, 0x03, 0x02, 0x13, 0x08, 0xE9, 0x00, 0x02, 0x00, 0xC6, 0x0A, 0x19, 0x02,
+    0x04, 0x01, 0x18, 0x0A, 0x97, 0x02, 0x03, 0x01, 0x19, 0x0A, 0xB7, 0x03, 0x05, 0x01, 0xC3, 0x0A,
+    0xDB, 0x01, 0x04, 0x02, 0x12, 0x0A, 0xFD, 0x03, 0x04, 0x02, 0x3A, 0x0B, 0x05, 0x03, 0x03, 0x01,
+    0xC3, 0x0B, 0x12, 0x02, 0x06, 0x00, 0xC2, 0x0B, 0x75, 0x02, 0x04, 0x02, 0x32, 0x0B, 0x87, 0x00,
+    0x03, 0x02, 0x13, 0x84, 0x0A, 0x19, 0x01, 0x05, 0x00, 0x68, 0x0A, 0x82, 0x02, 0x05, 0x01, 0xAF,
+    0x0B, 0x39, 0x00, 0x08, 0x00, 0x65, 0x0B, 0x4B, 0x00, 0x04, 0x02, 0x5A, 0x82, 0x0A, 0xA7, 0x03,
+    0x06, 0x01, 0x40, 0x0B, 0x12, 0x02, 0x05, 0x01, 0xFF, 0x8A, 0x00, 0x7B, 0x01, 0x01, 0x00, 0x0A,
+    0x01, 0xEC, 0x00, 0x02, 0x00, 0x09, 0x03, 0x61, 0x00, 0x02, 0x00, 0x09, 0x04, 0x3B, 0x00, 0x05,
+    0x01, 0xBE, 0x04, 0x5F, 0x00, 0x02, 0x00, 0x3C, 0x0A, 0x82, 0x02, 0x06, 0x00, 0xF2, 0x0A, 0xA7,
+    0x03, 0x04, 0x02, 0xDA, 0x0B, 0x27, 0x04, 0x04, 0x00, 0xF4, 0x0B, 0x39, 0x00, 0x05, 0x02, 0x09,
+    0x0B, 0x87, 0x02, 0x08, 0x00, 0x45, 0xF0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0x02, 0x01,
+    0x00, 0x03, 0x00, 0xB5, 0x02, 0x01, 0x00, 0x03, 0x02, 0x06, 0x02, 0x01, 0x00, 0x05, 0x03, 0x2E,
+    0x02, 0x01, 0x00, 0x4D, 0x03, 0x91, 0x00, 0x02, 0x00, 0x43, 0x03, 0x97, 0x00, 0x02, 0x00, 0x43,
+    0x04, 0x5F, 0x00, 0x02, 0x00, 0x86, 0x04, 0xBC, 0x02, 0x01, 0x00, 0x06, 0x08, 0xDB, 0x00, 0x01,
+    0x00, 0x04, 0x08, 0xF3, 0x00, 0x01, 0x00, 0x04, 0x08, 0xF8, 0x00, 0x01, 0x00, 0x04, 0x08, 0xFD,
+    0x00, 0x01, 0x00, 0x04, 0x09, 0x12, 0x00, 0x01, 0x00, 0x04, 0x09, 0x4D, 0x00, 0x04, 0x02, 0x7E,
+    0x09, 0x86, 0x02, 0x00, 0x00, 0x00, 0x09, 0x9A, 0x00, 0x01, 0x00, 0x04, 0x09, 0xA2, 0x00, 0x01,
+    0x00, 0x04, 0x09, 0xA7, 0x00, 0x03, 0x00, 0xD7, 0x09, 0xAC, 0x00, 0x01, 0x00, 0x04, 0x09, 0xDD,
+    0x00, 0x01, 0x00, 0x04, 0x09, 0xE2, 0x00, 0x01, 0x00, 0x04, 0x09, 0xEF, 0x00, 0x01, 0x00, 0x04,
+    0x09, 0xF9, 0x00, 0x01, 0x00, 0x04, 0x0A, 0x82, 0x01, 0x05, 0x01, 0x29, 0x60, 0x2C, 0x08, 0x9E,
+    0x2D, 0x08, 0xA3, 0x2E, 0x08, 0xA8, 0x3D, 0x08, 0xAD, 0x61, 0x08, 0xB2, 0x62, 0x08, 0xED, 0x63,
+    0x08, 0xF2, 0x64, 0x08, 0xF7, 0x65, 0x08, 0xFC, 0x66, 0x09, 0x0C, 0x67, 0x09, 0x11, 0x68, 0x09,
+    0x16, 0x69, 0x09, 0x1B, 0x6A, 0x09, 0x4C, 0x6B, 0x09, 0x51, 0x6C, 0x09, 0x5E, 0x6D, 0x09, 0x75,
+    0x6E, 0x09, 0x8F, 0x6F, 0x09, 0x94, 0x70, 0x09, 0x99, 0x71, 0x09, 0xA6, 0x72, 0x09, 0xAB, 0x73,
+    0x09, 0xC2, 0x74, 0x09, 0xCF, 0x75, 0x09, 0xDC, 0x76, 0x09, 0xE1, 0x77, 0x09, 0xE6, 0x78, 0x09,
+    0xF3, 0x79, 0x09, 0xF8, 0x7A, 0x09, 0xFD, 0xA2, 0x0A, 0x02, 0xA6, 0x0A, 0x07, 0x00, 0xA0, 0x00,
+    0x04, 0x02, 0xE2, 0xA0, 0x00, 0x01, 0x03, 0x62, 0xA0, 0x00, 0x01, 0x03, 0x63, 0xA0, 0x00, 0x01,
+    0x03, 0x62, 0xE0, 0x00, 0x01, 0x00, 0x06, 0x60, 0x64, 0x08, 0xCB, 0x6D, 0x08, 0xD0, 0x70, 0x08,
+    0xD5, 0x74, 0x08, 0xDA, 0x75, 0x08, 0xDF, 0xA6, 0x08, 0xE8, 0x00, 0xA0, 0x00, 0x01, 0x00, 0x0A,
+    0xA0, 0x00, 0x02, 0x02, 0xF3, 0xA0, 0x00, 0x02, 0x01, 0x8F, 0xA0, 0x00, 0x02, 0x02, 0xF3, 0x01,
+    0x71, 0xA6, 0x00, 0xA0, 0x00, 0x02, 0x01, 0x36, 0xA0, 0x00, 0x02, 0x00, 0x79, 0xA0, 0x00, 0x05,
+    0x01, 0x6E, 0xA0, 0x00, 0x01, 0x00, 0x0A, 0xA0, 0x00, 0x01, 0x00, 0x0A, 0xE0, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x67, 0x64, 0x75, 0x6A, 0x00, 0xA0, 0x01, 0x04, 0x02, 0x7E, 0xA0, 0x00, 0x04, 0x02,
+    0x72, 0xA0, 0x00, 0x01, 0x00, 0x0A, 0xA0, 0x00, 0x06, 0x01, 0x16, 0xE0, 0x00, 0x02, 0x00, 0xD8,
+    0x40, 0x6C, 0x09, 0x28, 0x76, 0x09, 0x42, 0x00, 0xE0, 0x00, 0x02, 0x00, 0x34, 0x40, 0x69, 0x09,
+    0x35, 0x6C, 0x09, 0x3D, 0x00, 0x01, 0x76, 0x00, 0xA0, 0x00, 0x02, 0x00, 0xD8, 0xA0, 0x00, 0x02,
+    0x00, 0xD8, 0x01, 0x69, 0x6C, 0x62, 0x00, 0xA0, 0x00, 0x02, 0x00, 0xD8, 0xA0, 0x00, 0x03, 0x03,
+    0x4F, 0xE0, 0x00, 0x01, 0x00, 0x08, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x03, 0x03, 0x07, 0xE0, 0x00,
+    0x01, 0x01, 0x59, 0x60, 0x70, 0x09, 0x6B, 0xA6, 0x09, 0x70, 0x00, 0xA0, 0x00, 0x01, 0x00, 0x0A,
+    0xA0, 0x00, 0x05, 0x01, 0xA0, 0xE0, 0x00, 0x03, 0x00, 0x97, 0x40, 0x69, 0x09, 0x82, 0x71, 0x09,
+    0x8A, 0x00, 0x01, 0x73, 0x00, 0xA0, 0x00, 0x0B, 0x00, 0x00, 0xA0, 0x00, 0x01, 0x01, 0x59, 0xA0,
+    0x00, 0x03, 0x00, 0xD7, 0xA0, 0x00, 0x01, 0x00, 0x03, 0xE0, 0x00, 0x01, 0x00, 0x0A, 0x01, 0xA6,
+    0x00, 0xA0, 0x00, 0x01, 0x00, 0x0A, 0xA0, 0x00, 0x04, 0x02, 0xCE, 0xE0, 0x00, 0x01, 0x00, 0x01,
+    0x40, 0x64, 0x09, 0xB8, 0x6D, 0x09, 0xBD, 0x00, 0xA0, 0x00, 0x01, 0x00, 0x0A, 0xA0, 0x01, 0x03,
+    0x02, 0xF8, 0xE0, 0x00, 0x01, 0x01, 0x59, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x01, 0x01, 0x59, 0xE0,
+    0x00, 0x04, 0x02, 0x7E, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x03, 0x01, 0x73, 0xA0, 0x00, 0x01, 0x00,
+    0x05, 0xA0, 0x00, 0x02, 0x00, 0x43, 0xE0, 0x00, 0x02, 0x00, 0x4B, 0x01, 0xA6, 0x00, 0xA0, 0x00,
+    0x02, 0x00, 0x4B, 0xA0, 0x00, 0x02, 0x00, 0x33, 0xA0, 0x00, 0x01, 0x00, 0x8C, 0xA0, 0x00, 0x03,
+    0x00, 0xD8, 0xA0, 0x00, 0x01, 0x03, 0x61, 0xA0, 0x00, 0x01, 0x00, 0x04, 0xE2, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x5F, 0x00, 0x05, 0x00, 0xED, 0x0A, 0x08, 0x00, 0x02, 0x01, 0x29, 0x60, 0x61, 0x0A,
+    0x79, 0x62, 0x0A, 0x86, 0x63, 0x0A, 0x8E, 0x64, 0x0A, 0x9B, 0x65, 0x0A, 0xA3, 0x66, 0x0A, 0xAB,
+    0x67, 0x0A, 0xB3, 0x68, 0x0A, 0xBB, 0x69, 0x0A, 0xD2, 0x6A, 0x0A, 0xDF, 0x6B, 0x0A, 0xEC, 0x6C,
+    0x0A, 0xF9, 0x6D, 0x0B, 0x01, 0x6E, 0x0B, 0x09, 0x6F, 0x0B, 0x0E, 0x70, 0x0B, 0x16, 0x71, 0x0B,
+    0x1E, 0x72, 0x0B, 0x23, 0x73, 0x0B, 0x2B, 0x74, 0x0B, 0x3D, 0x75, 0x0B, 0x4F, 0x76, 0x0B, 0x69,
+    0x77, 0x0B, 0x71, 0x78, 0x0B, 0x79, 0x79, 0x0B, 0x7E, 0xA2, 0x0B, 0x8B, 0xA3, 0x0B, 0x98, 0xA4,
+    0x0B, 0x9D, 0xA6, 0x0B, 0xA2, 0xA7, 0x0B, 0xA7, 0x00, 0xE0, 0x00, 0x02, 0x01, 0xDF, 0x01, 0xA6,
+    0x00, 0xA0, 0x00, 0x02, 0x01, 0xDF, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x01, 0x00, 0x05, 0xE0, 0x00,
+    0x01, 0x01, 0x59, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x03, 0x00, 0x55, 0x01, 0xA6, 0x00, 0xA0, 0x00,
+    0x01, 0x00, 0x06, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x03, 0x02, 0x37, 0x01, 0xA6, 0x00, 0xA0, 0x00,
+    0x03, 0x01, 0x09, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x03, 0x03, 0x2B, 0xE0, 0x00, 0x01, 0x00, 0x04,
+    0x60, 0x67, 0x0A, 0xC8, 0xA6, 0x0A, 0xCD, 0x00, 0xA0, 0x00, 0x02, 0x00, 0x09, 0xA0, 0x00, 0x03,
+    0x02, 0x3B, 0xE0, 0x00, 0x02, 0x00, 0x5B, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xE0,
+    0x00, 0x03, 0x02, 0x86, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x03, 0x02, 0x86, 0xE0, 0x00, 0x03, 0x03,
+    0x34, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x03, 0x03, 0x34, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x03, 0x03,
+    0x19, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x03, 0x02, 0xF2, 0xA0, 0x00, 0x01, 0x00, 0x11, 0x01, 0xA6,
+    0x00, 0xA0, 0x00, 0x02, 0x00, 0x04, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x02, 0x00, 0xB4, 0xA0, 0x00,
+    0x04, 0x02, 0xD2, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x04, 0x00, 0xFA, 0x60, 0x72, 0x0B, 0x33, 0xA6,
+    0x0B, 0x38, 0x00, 0xA0, 0x00, 0x01, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x60, 0x73, 0x0B,
+    0x45, 0xA6, 0x0B, 0x4A, 0x00, 0xA0, 0x00, 0x01, 0x00, 0x08, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0x61, 0x0B, 0x5A, 0x6F, 0x0B, 0x5F, 0xA6, 0x0B, 0x64, 0x00, 0xA0, 0x00, 0x02, 0x00, 0x77, 0xA0,
+    0x00, 0x02, 0x00, 0x77, 0xA0, 0x00, 0x02, 0x00, 0x96, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x03, 0x03,
+    0x16, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x02, 0x03, 0x57, 0xA0, 0x00, 0x02, 0x00, 0x43, 0xE0, 0x00,
+    0x02, 0x00, 0x06, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x02, 0x00, 0x06, 0xE0, 0x00, 0x01, 0x03, 0x64,
+    0x01, 0xA2, 0x00, 0xA0, 0x00, 0x01, 0x03, 0x64, 0xA0, 0x40, 0x01, 0x02, 0xDE, 0xA0, 0x00, 0x04,
+    0x02, 0xDE, 0xA0, 0x00, 0x03, 0x00, 0x11, 0xA0, 0x00, 0x01, 0x03, 0x64, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x64, 0x00, 0xA0, 0x00, 0x06, 0x00, 0xDA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x00,
+    0x6F, 0x00, 0x02, 0x03, 0x59, 0x04, 0x66, 0x00, 0x03, 0x03, 0x49, 0x04, 0xF0, 0x00, 0x04, 0x02,
+    0x42, 0x05, 0x8D, 0x00, 0x03, 0x03, 0x25, 0x0A, 0xDB, 0x01, 0x02, 0x03, 0x55, 0x0B, 0x4B, 0x00,
+    0x04, 0x02, 0x66, 0x01, 0x6F, 0x20, 0x00, 0x81, 0x04, 0xE2, 0x01, 0x0A, 0x00, 0x29, 0x83, 0x04,
+    0x5F, 0x00, 0x02, 0x02, 0x44, 0x04, 0xF0, 0x00, 0x02, 0x03, 0x5B, 0x0B, 0x39, 0x00, 0x04, 0x02,
+    0x8A
+};
+
+// Same trie with 16bit values stored little-endian at even offsets
+static const uint8_t sequence_transform_trie_aligned[SEQUENCE_TRIE_ALIGNED_SIZE] PROGMEM __attribute__((aligned(2))) = {
+    0x60, 0x00, 0x2D, 0x00, 0x7F, 0x00, 0x61, 0x00, 0x86, 0x00, 0x62, 0x00, 0xDA, 0x00, 0x63, 0x00,
+    0xEE, 0x00, 0x64, 0x00, 0x20, 0x01, 0x65, 0x00, 0xCA, 0x01, 0x66, 0x00, 0x2E, 0x02, 0x67, 0x00,
+    0x48, 0x02, 0x68, 0x00, 0xBC, 0x02, 0x69, 0x00, 0xDC, 0x02, 0x6B, 0x00, 0x58, 0x03, 0x6C, 0x00,
+    0x78, 0x03, 0x6D, 0x00, 0xE6, 0x03, 0x6E, 0x00, 0x24, 0x04, 0x6F, 0x00, 0x90, 0x04, 0x70, 0x00,
+    0xEE, 0x04, 0x71, 0x00, 0x08, 0x05, 0x72, 0x00, 0x16, 0x05, 0x73, 0x00, 0xAE, 0x05, 0x74, 0x00,
+    0x0A, 0x06, 0x75, 0x00, 0xE8, 0x06, 0x76, 0x00, 0x26, 0x07, 0x77, 0x00, 0x76, 0x07, 0x78, 0x00,
+    0x90, 0x07, 0x79, 0x00, 0x9E, 0x07, 0x80, 0x00, 0xDC, 0x07, 0x81, 0x00, 0xA4, 0x0A, 0x82, 0x00,
+    0x84, 0x0C, 0x83, 0x00, 0x92, 0x0C, 0xA6, 0x00, 0x98, 0x0C, 0xA7, 0x00, 0xCA, 0x0C, 0x00, 0x81,
+    0x12, 0x05, 0x00, 0x0A, 0x0B, 0x00, 0xCB, 0x00, 0x6E, 0x03, 0x00, 0x05, 0xE1, 0x01, 0x8C, 0x04,
+    0x00, 0x01, 0x03, 0x00, 0x14, 0x06, 0x00, 0x02, 0xB2, 0x00, 0x2A, 0x0A, 0x01, 0x07, 0xB4, 0x00,
+    0x50, 0x0B, 0x03, 0x05, 0x8C, 0x01, 0x70, 0x0B, 0x03, 0x08, 0x6D, 0x00, 0xBE, 0x0B, 0x03, 0x04,
+    0x1A, 0x02, 0xDC, 0x0B, 0x02, 0x03, 0x2E, 0x03, 0x00, 0x0C, 0x00, 0x04, 0xBE, 0x02, 0x16, 0x0C,
+    0x00, 0x03, 0xF2, 0x02, 0x46, 0x0C, 0x01, 0x02, 0x4B, 0x01, 0x01, 0x71, 0x00, 0xE0, 0x00, 0x02,
+    0x6D, 0x00, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x02, 0x6D, 0x00, 0x83, 0x00, 0xB6, 0x0B, 0x03, 0x09,
+    0x3C, 0x00, 0xD4, 0x0B, 0x02, 0x05, 0x50, 0x01, 0xDC, 0x0B, 0x00, 0x04, 0x1E, 0x02, 0x88, 0x00,
+    0x5A, 0x0A, 0x01, 0x03, 0x4C, 0x03, 0x42, 0x0B, 0x00, 0x04, 0x26, 0x02, 0x60, 0x0B, 0x03, 0x07,
+    0xBB, 0x00, 0x68, 0x0B, 0x03, 0x03, 0xE3, 0x01, 0xC6, 0x0B, 0x03, 0x03, 0x4C, 0x03, 0xD4, 0x0B,
+    0x02, 0x04, 0x22, 0x02, 0xEA, 0x0B, 0x04, 0x05, 0x69, 0x01, 0x00, 0x0C, 0x00, 0x06, 0xC8, 0x00,
+    0x90, 0x1C, 0x90, 0x01, 0x00, 0x01, 0x4A, 0x00, 0x96, 0x01, 0x00, 0x01, 0x4A, 0x00, 0xF8, 0x01,
+    0x00, 0x02, 0x48, 0x02, 0x16, 0x02, 0x00, 0x02, 0x48, 0x02, 0xB8, 0x03, 0x00, 0x02, 0xA6, 0x01,
+    0xBE, 0x03, 0x00, 0x02, 0xA6, 0x01, 0x8C, 0x04, 0x00, 0x04, 0x46, 0x02, 0x74, 0x05, 0x00, 0x02,
+    0xA6, 0x01, 0x4E, 0x07, 0x00, 0x02, 0xA6, 0x01, 0x50, 0x09, 0x00, 0x03, 0xF5, 0x02, 0x30, 0x0A,
+    0x00, 0x02, 0xA6, 0x01, 0xB2, 0x0A, 0x02, 0x03, 0x04, 0x03, 0x3A, 0x0B, 0x02, 0x05, 0xDC, 0x01,
+    0x58, 0x0B, 0x01, 0x05, 0x64, 0x01, 0x68, 0x0B, 0x03, 0x03, 0x1F, 0x03, 0x8C, 0x0B, 0x02, 0x01,
+    0x4A, 0x00, 0x9A, 0x0B, 0x01, 0x03, 0xE6, 0x02, 0xA8, 0x0B, 0x03, 0x04, 0xCA, 0x02, 0xAE, 0x0B,
+    0x00, 0x05, 0xA5, 0x01, 0xB6, 0x0B, 0x00, 0x05, 0xA5, 0x01, 0xD4, 0x0B, 0x02, 0x04, 0xA2, 0x02,
+    0xEA, 0x0B, 0x04, 0x04, 0xDD, 0x01, 0x00, 0x0C, 0x00, 0x04, 0xDD, 0x01, 0x3E, 0x0C, 0x00, 0x02,
+    0xA6, 0x01, 0x46, 0x0C, 0x02, 0x03, 0xFE, 0x02, 0x5A, 0x0C, 0x00, 0x02, 0x48, 0x02, 0x68, 0x0C,
+    0x03, 0x0A, 0x15, 0x00, 0x8E, 0x0C, 0x00, 0x02, 0xA6, 0x01, 0xCF, 0x00, 0x8C, 0x04, 0x00, 0x01,
+    0x05, 0x00, 0xBE, 0x05, 0x00, 0x03, 0x87, 0x01, 0x82, 0x0A, 0x02, 0x03, 0x73, 0x01, 0x42, 0x0B,
+    0x00, 0x02, 0x86, 0x00, 0x50, 0x0B, 0x03, 0x04, 0x5B, 0x01, 0x68, 0x0B, 0x03, 0x03, 0x72, 0x01,
+    0x70, 0x0B, 0x03, 0x06, 0xCE, 0x00, 0x8C, 0x0B, 0x03, 0x01, 0x05, 0x00, 0x9A, 0x0B, 0x00, 0x06,
+    0xFE, 0x00, 0xC6, 0x0B, 0x03, 0x03, 0x7A, 0x00, 0xDC, 0x0B, 0x02, 0x05, 0x78, 0x01, 0xEA, 0x0B,
+    0x04, 0x03, 0x01, 0x03, 0x00, 0x0C, 0x00, 0x02, 0x69, 0x00, 0x46, 0x0C, 0x01, 0x03, 0x43, 0x00,
+    0x5A, 0x0C, 0x00, 0x03, 0x2F, 0x02, 0x01, 0x71, 0x00, 0xA0, 0x00, 0x02, 0x85, 0x00, 0x84, 0x00,
+    0x58, 0x0B, 0x01, 0x05, 0x9B, 0x01, 0xBE, 0x0B, 0x02, 0x02, 0x42, 0x00, 0xD4, 0x0B, 0x02, 0x04,
+    0x41, 0x00, 0x36, 0x0C, 0x00, 0x03, 0x10, 0x03, 0x90, 0x13, 0xC0, 0x00, 0x01, 0x03, 0x5A, 0x00,
+    0xFE, 0x01, 0x01, 0x03, 0x5A, 0x00, 0x8C, 0x04, 0x00, 0x03, 0x5A, 0x00, 0xBE, 0x04, 0x00, 0x03,
+    0x5A, 0x00, 0x74, 0x05, 0x00, 0x03, 0x5A, 0x00, 0xFA, 0x05, 0x01, 0x03, 0x5A, 0x00, 0x34, 0x09,
+    0x01, 0x03, 0x5A, 0x00, 0x40, 0x09, 0x01, 0x03, 0x5A, 0x00, 0xB2, 0x0A, 0x00, 0x04, 0x59, 0x00,
+    0x42, 0x0B, 0x00, 0x03, 0xAF, 0x00, 0x60, 0x0B, 0x03, 0x05, 0xB4, 0x01, 0x8C, 0x0B, 0x01, 0x03,
+    0x5A, 0x00, 0xBE, 0x0B, 0x01, 0x03, 0x5A, 0x00, 0xC6, 0x0B, 0x01, 0x03, 0x5A, 0x00, 0xD4, 0x0B,
+    0x02, 0x07, 0xAD, 0x00, 0x00, 0x0C, 0x00, 0x08, 0x55, 0x00, 0x16, 0x0C, 0x00, 0x05, 0xE6, 0x00,
+    0x36, 0x0C, 0x02, 0x06, 0x22, 0x01, 0x3E, 0x0C, 0x00, 0x03, 0x5A, 0x00, 0x85, 0x00, 0x50, 0x0B,
+    0x03, 0x04, 0x56, 0x02, 0xDC, 0x0B, 0x02, 0x04, 0xBA, 0x02, 0xEA, 0x0B, 0x04, 0x04, 0x36, 0x02,
+    0x00, 0x0C, 0x00, 0x06, 0x0A, 0x01, 0x46, 0x0C, 0x01, 0x03, 0x1C, 0x03, 0xD0, 0x13, 0xA2, 0x00,
+    0x01, 0x03, 0x5A, 0x00, 0x90, 0x01, 0x01, 0x03, 0x5A, 0x00, 0x96, 0x01, 0x01, 0x03, 0x5A, 0x00,
+    0x9C, 0x01, 0x00, 0x03, 0x5A, 0x00, 0x08, 0x04, 0x01, 0x03, 0x5A, 0x00, 0x3A, 0x04, 0x00, 0x03,
+    0x5A, 0x00, 0x8C, 0x04, 0x00, 0x03, 0x71, 0x02, 0x38, 0x05, 0x01, 0x03, 0x5A, 0x00, 0x82, 0x0A,
+    0x02, 0x03, 0xC3, 0x02, 0x50, 0x0B, 0x01, 0x03, 0x5A, 0x00, 0x58, 0x0B, 0x01, 0x02, 0x06, 0x01,
+    0x70, 0x0B, 0x01, 0x03, 0x5A, 0x00, 0xBE, 0x0B, 0x02, 0x03, 0xE9, 0x00, 0xC6, 0x0B, 0x03, 0x04,
+    0xFA, 0x00, 0xEA, 0x0B, 0x03, 0x03, 0x19, 0x01, 0x00, 0x0C, 0x00, 0x04, 0xC2, 0x02, 0x36, 0x0C,
+    0x01, 0x03, 0x5A, 0x00, 0x3E, 0x0C, 0x02, 0x04, 0xD6, 0x00, 0x46, 0x0C, 0x01, 0x03, 0x13, 0x03,
+    0x01, 0x71, 0x00, 0xA0, 0x00, 0x02, 0xD2, 0x02, 0x85, 0x00, 0x90, 0x00, 0x00, 0x02, 0x23, 0x03,
+    0x8C, 0x04, 0x00, 0x03, 0x22, 0x03, 0xA6, 0x04, 0x00, 0x05, 0x55, 0x01, 0x42, 0x0B, 0x01, 0x03,
+    0xEC, 0x02, 0x46, 0x0C, 0x02, 0x03, 0x3D, 0x03, 0x90, 0x12, 0xF8, 0x01, 0x00, 0x03, 0x0F, 0x02,
+    0x16, 0x02, 0x00, 0x03, 0x0F, 0x02, 0x64, 0x04, 0x00, 0x04, 0x5E, 0x02, 0xBA, 0x07, 0x00, 0x03,
+    0x0F, 0x02, 0x50, 0x09, 0x02, 0x03, 0x31, 0x03, 0x52, 0x0A, 0x01, 0x05, 0x5F, 0x01, 0x5A, 0x0A,
+    0x01, 0x05, 0x5F, 0x01, 0x3A, 0x0B, 0x02, 0x06, 0xF8, 0x00, 0x42, 0x0B, 0x00, 0x05, 0xAA, 0x01,
+    0x50, 0x0B, 0x03, 0x03, 0x7B, 0x02, 0x58, 0x0B, 0x01, 0x06, 0xDA, 0x00, 0x68, 0x0B, 0x03, 0x05,
+    0xB9, 0x01, 0x8C, 0x0B, 0x03, 0x03, 0x0A, 0x03, 0x9A, 0x0B, 0x01, 0x04, 0x0E, 0x02, 0xDC, 0x0B,
+    0x02, 0x04, 0x76, 0x02, 0x00, 0x0C, 0x00, 0x05, 0x04, 0x02, 0x46, 0x0C, 0x02, 0x04, 0x2A, 0x02,
+    0x5A, 0x0C, 0x00, 0x03, 0x0F, 0x02, 0x8A, 0x00, 0xB8, 0x03, 0x00, 0x04, 0x7E, 0x02, 0x20, 0x05,
+    0x00, 0x03, 0x0D, 0x03, 0x4E, 0x07, 0x00, 0x04, 0x7E, 0x02, 0xC6, 0x07, 0x00, 0x04, 0x60, 0x00,
+    0xB2, 0x0A, 0x02, 0x05, 0xF0, 0x01, 0x50, 0x0B, 0x01, 0x05, 0xCD, 0x01, 0x9A, 0x0B, 0x01, 0x03,
+    0xE9, 0x02, 0xDC, 0x0B, 0x00, 0x04, 0x52, 0x02, 0xEA, 0x0B, 0x04, 0x07, 0x7C, 0x00, 0x00, 0x0C,
+    0x00, 0x04, 0x7A, 0x02, 0xCE, 0x00, 0x04, 0x03, 0x03, 0x02, 0x5A, 0x00, 0x38, 0x05, 0x01, 0x03,
+    0x4B, 0x02, 0x3A, 0x0B, 0x02, 0x04, 0xE0, 0x00, 0x50, 0x0B, 0x02, 0x06, 0x04, 0x01, 0x58, 0x0B,
+    0x00, 0x02, 0x5F, 0x03, 0x60, 0x0B, 0x03, 0x03, 0x52, 0x03, 0xBE, 0x0B, 0x02, 0x02, 0x04, 0x00,
+    0xC6, 0x0B, 0x03, 0x03, 0x15, 0x02, 0xDC, 0x0B, 0x02, 0x05, 0x82, 0x01, 0x00, 0x0C, 0x00, 0x04,
+    0x6A, 0x02, 0x16, 0x0C, 0x00, 0x04, 0x3E, 0x02, 0x36, 0x0C, 0x02, 0x04, 0x82, 0x02, 0x3E, 0x0C,
+    0x03, 0x06, 0xD4, 0x00, 0x46, 0x0C, 0x01, 0x02, 0x86, 0x00, 0x60, 0x00, 0xA2, 0x00, 0x85, 0x04,
+    0xA6, 0x00, 0x8A, 0x04, 0x00, 0xA0, 0x00, 0x01, 0x04, 0x00, 0xA0, 0x00, 0x00, 0x02, 0x58, 0x00,
+    0xCE, 0x00, 0x8C, 0x04, 0x00, 0x01, 0x06, 0x00, 0x12, 0x05, 0x00, 0x0A, 0x1F, 0x00, 0x74, 0x06,
+    0x00, 0x03, 0x43, 0x03, 0x82, 0x0A, 0x02, 0x03, 0x6B, 0x01, 0x42, 0x0B, 0x01, 0x03, 0x29, 0x01,
+    0x50, 0x0B, 0x02, 0x04, 0xD6, 0x02, 0x70, 0x0B, 0x03, 0x03, 0x37, 0x03, 0xBE, 0x0B, 0x03, 0x03,
+    0x3A, 0x03, 0xC6, 0x0B, 0x03, 0x03, 0x40, 0x03, 0xDC, 0x0B, 0x02, 0x04, 0x9A, 0x02, 0x00, 0x0C,
+    0x00, 0x06, 0x10, 0x01, 0x16, 0x0C, 0x00, 0x08, 0x0D, 0x00, 0x46, 0x0C, 0x02, 0x04, 0x92, 0x02,
+    0x5A, 0x0C, 0x02, 0x05, 0x73, 0x01, 0x01, 0x71, 0x00, 0xA0, 0x00, 0x02, 0x5D, 0x03, 0x84, 0x00,
+    0x3A, 0x0B, 0x02, 0x05, 0xD2, 0x01, 0x60, 0x0B, 0x03, 0x05, 0xFA, 0x01, 0xD4, 0x0B, 0x02, 0x07,
+    0xA6, 0x00, 0x00, 0x0C, 0x00, 0x06, 0x1C, 0x01, 0x82, 0x00, 0x60, 0x0B, 0x03, 0x04, 0x9E, 0x02,
+    0x00, 0x0C, 0x00, 0x07, 0x83, 0x00, 0x90, 0x19, 0xC0, 0x02, 0x00, 0x03, 0xD7, 0x01, 0x8C, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x94, 0x04, 0x00, 0x05, 0xED, 0x00, 0x1C, 0x07, 0x00, 0x02, 0x43, 0x00,
+    0xBA, 0x07, 0x00, 0x03, 0x2F, 0x02, 0x82, 0x0A, 0x02, 0x04, 0xAA, 0x02, 0xB2, 0x0A, 0x02, 0x07,
+    0x75, 0x00, 0x3A, 0x0B, 0x02, 0x04, 0x4E, 0x02, 0x42, 0x0B, 0x01, 0x06, 0x28, 0x01, 0x50, 0x0B,
+    0x03, 0x04, 0xB2, 0x02, 0x58, 0x0B, 0x01, 0x05, 0xF5, 0x01, 0x60, 0x0B, 0x02, 0x03, 0x46, 0x03,
+    0x68, 0x0B, 0x02, 0x04, 0x62, 0x02, 0x70, 0x0B, 0x03, 0x04, 0xAE, 0x02, 0x8C, 0x0B, 0x03, 0x03,
+    0x43, 0x00, 0x9A, 0x0B, 0x00, 0x07, 0x98, 0x00, 0xB6, 0x0B, 0x03, 0x07, 0x8A, 0x00, 0xC6, 0x0B,
+    0x03, 0x05, 0x29, 0x01, 0xD4, 0x0B, 0x02, 0x04, 0x2A, 0x01, 0xDC, 0x0B, 0x01, 0x05, 0x87, 0x01,
+    0x16, 0x0C, 0x00, 0x06, 0xEC, 0x00, 0x36, 0x0C, 0x00, 0x01, 0x0D, 0x00, 0x3E, 0x0C, 0x00, 0x02,
+    0x43, 0x00, 0x46, 0x0C, 0x02, 0x04, 0x2E, 0x02, 0x8E, 0x0C, 0x00, 0x02, 0x43, 0x00, 0x8F, 0x00,
+    0xF8, 0x01, 0x00, 0x02, 0x80, 0x01, 0x16, 0x02, 0x00, 0x02, 0x80, 0x01, 0x8C, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x05, 0x00, 0x05, 0x7D, 0x01, 0x26, 0x06, 0x00, 0x02, 0x80, 0x01, 0xAA, 0x06,
+    0x04, 0x03, 0x93, 0x01, 0xD4, 0x06, 0x04, 0x05, 0x91, 0x01, 0x50, 0x09, 0x01, 0x06, 0x2E, 0x01,
+    0x3A, 0x0B, 0x01, 0x04, 0xB6, 0x02, 0x42, 0x0B, 0x00, 0x05, 0x5A, 0x01, 0x58, 0x0B, 0x00, 0x02,
+    0x33, 0x00, 0x8C, 0x0B, 0x03, 0x04, 0x96, 0x02, 0x9A, 0x0B, 0x00, 0x07, 0x91, 0x00, 0xDC, 0x0B,
+    0x02, 0x07, 0x9F, 0x00, 0x00, 0x0C, 0x00, 0x06, 0x3A, 0x01, 0xD0, 0x23, 0x7E, 0x01, 0x00, 0x03,
+    0x48, 0x01, 0x8A, 0x01, 0x01, 0x04, 0x7E, 0x02, 0x32, 0x02, 0x00, 0x03, 0x97, 0x00, 0x1C, 0x03,
+    0x00, 0x03, 0x48, 0x01, 0x8C, 0x04, 0x00, 0x02, 0x4B, 0x01, 0x94, 0x04, 0x00, 0x04, 0xE8, 0x00,
+    0x0C, 0x05, 0x01, 0x02, 0x3B, 0x00, 0x44, 0x05, 0x04, 0x05, 0xD7, 0x01, 0xA4, 0x05, 0x03, 0x05,
+    0xD7, 0x01, 0xEE, 0x05, 0x00, 0x03, 0x48, 0x01, 0xF4, 0x05, 0x04, 0x05, 0x46, 0x01, 0xFE, 0x06,
+    0x00, 0x03, 0x48, 0x01, 0x1C, 0x07, 0x00, 0x03, 0x48, 0x01, 0x22, 0x07, 0x00, 0x03, 0x48, 0x01,
+    0xC6, 0x07, 0x00, 0x05, 0x58, 0x00, 0xEA, 0x07, 0x01, 0x06, 0x34, 0x01, 0x50, 0x09, 0x00, 0x02,
+    0x31, 0x01, 0x82, 0x0A, 0x02, 0x03, 0x28, 0x03, 0xB2, 0x0A, 0x02, 0x05, 0x4B, 0x01, 0x3A, 0x0B,
+    0x02, 0x06, 0xE0, 0x00, 0x42, 0x0B, 0x00, 0x05, 0xE6, 0x01, 0x50, 0x0B, 0x03, 0x04, 0x16, 0x02,
+    0x58, 0x0B, 0x00, 0x03, 0x48, 0x01, 0x68, 0x0B, 0x03, 0x03, 0xEF, 0x02, 0x70, 0x0B, 0x03, 0x04,
+    0xA6, 0x02, 0x8C, 0x0B, 0x00, 0x03, 0x48, 0x01, 0x9A, 0x0B, 0x00, 0x04, 0x47, 0x01, 0xBE, 0x0B,
+    0x03, 0x03, 0xFB, 0x02, 0xD4, 0x0B, 0x02, 0x04, 0x4A, 0x02, 0xDC, 0x0B, 0x02, 0x04, 0x86, 0x02,
+    0x00, 0x0C, 0x00, 0x08, 0x5D, 0x00, 0x16, 0x0C, 0x00, 0x06, 0xE6, 0x00, 0x36, 0x0C, 0x02, 0x05,
+    0xC8, 0x01, 0x46, 0x0C, 0x02, 0x04, 0x8E, 0x02, 0x8E, 0x0C, 0x00, 0x04, 0x7E, 0x02, 0x01, 0x73,
+    0x00, 0x81, 0xEA, 0x0B, 0x05, 0x09, 0x33, 0x00, 0x8A, 0x00, 0x64, 0x04, 0x00, 0x04, 0x6E, 0x02,
+    0x94, 0x04, 0x00, 0x03, 0xE8, 0x00, 0x42, 0x0B, 0x01, 0x05, 0x40, 0x00, 0x50, 0x0B, 0x02, 0x03,
+    0x98, 0x01, 0x58, 0x0B, 0x01, 0x08, 0x4D, 0x00, 0x70, 0x0B, 0x03, 0x04, 0xC6, 0x02, 0xC6, 0x0B,
+    0x03, 0x03, 0x4F, 0x03, 0xDC, 0x0B, 0x02, 0x05, 0xEB, 0x01, 0x00, 0x0C, 0x00, 0x05, 0x96, 0x01,
+    0x46, 0x0C, 0x02, 0x04, 0x97, 0x01, 0x8D, 0x00, 0xFE, 0x06, 0x00, 0x03, 0x13, 0x02, 0x1C, 0x07,
+    0x00, 0x03, 0x13, 0x02, 0x22, 0x07, 0x00, 0x03, 0x13, 0x02, 0x50, 0x09, 0x00, 0x02, 0xC6, 0x00,
+    0xB2, 0x0A, 0x02, 0x04, 0x18, 0x01, 0x50, 0x0B, 0x02, 0x03, 0x19, 0x01, 0x70, 0x0B, 0x03, 0x05,
+    0xC3, 0x01, 0x9A, 0x0B, 0x01, 0x04, 0x12, 0x02, 0xBE, 0x0B, 0x03, 0x04, 0x3A, 0x02, 0xC6, 0x0B,
+    0x03, 0x03, 0xC3, 0x01, 0xD4, 0x0B, 0x02, 0x06, 0xC2, 0x00, 0x46, 0x0C, 0x02, 0x04, 0x32, 0x02,
+    0x5A, 0x0C, 0x00, 0x03, 0x13, 0x02, 0x84, 0x00, 0xB2, 0x0A, 0x01, 0x05, 0x68, 0x00, 0x3A, 0x0B,
+    0x02, 0x05, 0xAF, 0x01, 0x00, 0x0C, 0x00, 0x08, 0x65, 0x00, 0x16, 0x0C, 0x00, 0x04, 0x5A, 0x02,
+    0x82, 0x00, 0x60, 0x0B, 0x03, 0x06, 0x40, 0x01, 0xD4, 0x0B, 0x02, 0x05, 0xFF, 0x01, 0x8A, 0x00,
+    0x9C, 0x00, 0x01, 0x01, 0x0A, 0x00, 0x10, 0x02, 0x00, 0x02, 0x09, 0x00, 0x88, 0x03, 0x00, 0x02,
+    0x09, 0x00, 0x64, 0x04, 0x00, 0x05, 0xBE, 0x01, 0x8C, 0x04, 0x00, 0x02, 0x3C, 0x00, 0x3A, 0x0B,
+    0x02, 0x06, 0xF2, 0x00, 0x60, 0x0B, 0x03, 0x04, 0xDA, 0x02, 0xEA, 0x0B, 0x04, 0x04, 0xF4, 0x00,
+    0x00, 0x0C, 0x00, 0x05, 0x09, 0x02, 0x5A, 0x0C, 0x02, 0x08, 0x45, 0x00, 0xF0, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0xCE, 0x00, 0x02, 0x01, 0x03, 0x00, 0xD6, 0x00, 0x02, 0x01, 0x03, 0x00, 0x2A, 0x02,
+    0x02, 0x01, 0x05, 0x00, 0x54, 0x03, 0x02, 0x01, 0x4D, 0x00, 0xB8, 0x03, 0x00, 0x02, 0x43, 0x00,
+    0xBE, 0x03, 0x00, 0x02, 0x43, 0x00, 0x8C, 0x04, 0x00, 0x02, 0x86, 0x00, 0xEA, 0x04, 0x02, 0x01,
+    0x06, 0x00, 0x40, 0x09, 0x00, 0x01, 0x04, 0x00, 0x5C, 0x09, 0x00, 0x01, 0x04, 0x00, 0x62, 0x09,
+    0x00, 0x01, 0x04, 0x00, 0x68, 0x09, 0x00, 0x01, 0x04, 0x00, 0x80, 0x09, 0x00, 0x01, 0x04, 0x00,
+    0xC6, 0x09, 0x00, 0x04, 0x7E, 0x02, 0x0A, 0x0A, 0x02, 0x00, 0x00, 0x00, 0x22, 0x0A, 0x00, 0x01,
+    0x04, 0x00, 0x2A, 0x0A, 0x00, 0x01, 0x04, 0x00, 0x30, 0x0A, 0x00, 0x03, 0xD7, 0x00, 0x36, 0x0A,
+    0x00, 0x01, 0x04, 0x00, 0x6E, 0x0A, 0x00, 0x01, 0x04, 0x00, 0x74, 0x0A, 0x00, 0x01, 0x04, 0x00,
+    0x82, 0x0A, 0x00, 0x01, 0x04, 0x00, 0x8E, 0x0A, 0x00, 0x01, 0x04, 0x00, 0x3A, 0x0B, 0x01, 0x05,
+    0x29, 0x01, 0x60, 0x00, 0x2C, 0x00, 0xF5, 0x08, 0x2D, 0x00, 0xFA, 0x08, 0x2E, 0x00, 0x00, 0x09,
+    0x3D, 0x00, 0x06, 0x09, 0x61, 0x00, 0x0C, 0x09, 0x62, 0x00, 0x54, 0x09, 0x63, 0x00, 0x5A, 0x09,
+    0x64, 0x00, 0x60, 0x09, 0x65, 0x00, 0x66, 0x09, 0x66, 0x00, 0x78, 0x09, 0x67, 0x00, 0x7E, 0x09,
+    0x68, 0x00, 0x84, 0x09, 0x69, 0x00, 0x8A, 0x09, 0x6A, 0x00, 0xC4, 0x09, 0x6B, 0x00, 0xCA, 0x09,
+    0x6C, 0x00, 0xD8, 0x09, 0x6D, 0x00, 0xF4, 0x09, 0x6E, 0x00, 0x14, 0x0A, 0x6F, 0x00, 0x1A, 0x0A,
+    0x70, 0x00, 0x20, 0x0A, 0x71, 0x00, 0x2E, 0x0A, 0x72, 0x00, 0x34, 0x0A, 0x73, 0x00, 0x50, 0x0A,
+    0x74, 0x00, 0x5E, 0x0A, 0x75, 0x00, 0x6C, 0x0A, 0x76, 0x00, 0x72, 0x0A, 0x77, 0x00, 0x78, 0x0A,
+    0x78, 0x00, 0x86, 0x0A, 0x79, 0x00, 0x8C, 0x0A, 0x7A, 0x00, 0x92, 0x0A, 0xA2, 0x00, 0x98, 0x0A,
+    0xA6, 0x00, 0x9E, 0x0A, 0x00, 0xA0, 0x00, 0x04, 0xE2, 0x02, 0xA0, 0x00, 0x00, 0x01, 0x62, 0x03,
+    0xA0, 0x00, 0x00, 0x01, 0x63, 0x03, 0xA0, 0x00, 0x00, 0x01, 0x62, 0x03, 0xE0, 0x00, 0x00, 0x01,
+    0x06, 0x00, 0x60, 0x00, 0x64, 0x00, 0x2D, 0x09, 0x6D, 0x00, 0x32, 0x09, 0x70, 0x00, 0x38, 0x09,
+    0x74, 0x00, 0x3E, 0x09, 0x75, 0x00, 0x44, 0x09, 0xA6, 0x00, 0x4E, 0x09, 0x00, 0xA0, 0x00, 0x01,
+    0x0A, 0x00, 0xA0, 0x00, 0x00, 0x02, 0xF3, 0x02, 0xA0, 0x00, 0x00, 0x02, 0x8F, 0x01, 0xA0, 0x00,
+    0x00, 0x02, 0xF3, 0x02, 0x01, 0x71, 0xA6, 0x00, 0xA0, 0x00, 0x00, 0x02, 0x36, 0x01, 0xA0, 0x00,
+    0x00, 0x02, 0x79, 0x00, 0xA0, 0x00, 0x00, 0x05, 0x6E, 0x01, 0xA0, 0x00, 0x00, 0x01, 0x0A, 0x00,
+    0xA0, 0x00, 0x00, 0x01, 0x0A, 0x00, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x67, 0x64, 0x75,
+    0x6A, 0x00, 0xA0, 0x00, 0x01, 0x04, 0x7E, 0x02, 0xA0, 0x00, 0x00, 0x04, 0x72, 0x02, 0xA0, 0x00,
+    0x00, 0x01, 0x0A, 0x00, 0xA0, 0x00, 0x00, 0x06, 0x16, 0x01, 0xE0, 0x00, 0x00, 0x02, 0xD8, 0x00,
+    0x40, 0x00, 0x6C, 0x00, 0x9B, 0x09, 0x76, 0x00, 0xBA, 0x09, 0x00, 0xE0, 0x00, 0x02, 0x34, 0x00,
+    0x40, 0x00, 0x69, 0x00, 0xAB, 0x09, 0x6C, 0x00, 0xB4, 0x09, 0x00, 0x01, 0x76, 0x00, 0xA0, 0x00,
+    0x00, 0x02, 0xD8, 0x00, 0xA0, 0x00, 0x00, 0x02, 0xD8, 0x00, 0x01, 0x69, 0x6C, 0x62, 0x00, 0xA0,
+    0x00, 0x02, 0xD8, 0x00, 0xA0, 0x00, 0x00, 0x03, 0x4F, 0x03, 0xE0, 0x00, 0x00, 0x01, 0x08, 0x00,
+    0x01, 0xA6, 0x00, 0xA0, 0x00, 0x03, 0x07, 0x03, 0xE0, 0x00, 0x00, 0x01, 0x59, 0x01, 0x60, 0x00,
+    0x70, 0x00, 0xE9, 0x09, 0xA6, 0x00, 0xEE, 0x09, 0x00, 0xA0, 0x00, 0x01, 0x0A, 0x00, 0xA0, 0x00,
+    0x00, 0x05, 0xA0, 0x01, 0xE0, 0x00, 0x00, 0x03, 0x97, 0x00, 0x40, 0x00, 0x69, 0x00, 0x05, 0x0A,
+    0x71, 0x00, 0x0E, 0x0A, 0x00, 0x01, 0x73, 0x00, 0xA0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0xA0, 0x00,
+    0x00, 0x01, 0x59, 0x01, 0xA0, 0x00, 0x00, 0x03, 0xD7, 0x00, 0xA0, 0x00, 0x00, 0x01, 0x03, 0x00,
+    0xE0, 0x00, 0x00, 0x01, 0x0A, 0x00, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x01, 0x0A, 0x00, 0xA0, 0x00,
+    0x00, 0x04, 0xCE, 0x02, 0xE0, 0x00, 0x00, 0x01, 0x01, 0x00, 0x40, 0x00, 0x64, 0x00, 0x45, 0x0A,
+    0x6D, 0x00, 0x4A, 0x0A, 0x00, 0xA0, 0x00, 0x01, 0x0A, 0x00, 0xA0, 0x00, 0x01, 0x03, 0xF8, 0x02,
+    0xE0, 0x00, 0x00, 0x01, 0x59, 0x01, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x01, 0x59, 0x01, 0xE0, 0x00,
+    0x00, 0x04, 0x7E, 0x02, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x03, 0x73, 0x01, 0xA0, 0x00, 0x00, 0x01,
+    0x05, 0x00, 0xA0, 0x00, 0x00, 0x02, 0x43, 0x00, 0xE0, 0x00, 0x00, 0x02, 0x4B, 0x00, 0x01, 0xA6,
+    0x00, 0xA0, 0x00, 0x02, 0x4B, 0x00, 0xA0, 0x00, 0x00, 0x02, 0x33, 0x00, 0xA0, 0x00, 0x00, 0x01,
+    0x8C, 0x00, 0xA0, 0x00, 0x00, 0x03, 0xD8, 0x00, 0xA0, 0x00, 0x00, 0x01, 0x61, 0x03, 0xA0, 0x00,
+    0x00, 0x01, 0x04, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x04, 0x00, 0x05, 0xED, 0x00,
+    0xA0, 0x0A, 0x00, 0x02, 0x29, 0x01, 0x60, 0x00, 0x61, 0x00, 0x31, 0x0B, 0x62, 0x00, 0x3E, 0x0B,
+    0x63, 0x00, 0x46, 0x0B, 0x64, 0x00, 0x54, 0x0B, 0x65, 0x00, 0x5C, 0x0B, 0x66, 0x00, 0x64, 0x0B,
+    0x67, 0x00, 0x6C, 0x0B, 0x68, 0x00, 0x74, 0x0B, 0x69, 0x00, 0x90, 0x0B, 0x6A, 0x00, 0x9E, 0x0B,
+    0x6B, 0x00, 0xAC, 0x0B, 0x6C, 0x00, 0xBA, 0x0B, 0x6D, 0x00, 0xC2, 0x0B, 0x6E, 0x00, 0xCA, 0x0B,
+    0x6F, 0x00, 0xD0, 0x0B, 0x70, 0x00, 0xD8, 0x0B, 0x71, 0x00, 0xE0, 0x0B, 0x72, 0x00, 0xE6, 0x0B,
+    0x73, 0x00, 0xEE, 0x0B, 0x74, 0x00, 0x04, 0x0C, 0x75, 0x00, 0x1A, 0x0C, 0x76, 0x00, 0x3A, 0x0C,
+    0x77, 0x00, 0x42, 0x0C, 0x78, 0x00, 0x4A, 0x0C, 0x79, 0x00, 0x50, 0x0C, 0xA2, 0x00, 0x5E, 0x0C,
+    0xA3, 0x00, 0x6C, 0x0C, 0xA4, 0x00, 0x72, 0x0C, 0xA6, 0x00, 0x78, 0x0C, 0xA7, 0x00, 0x7E, 0x0C,
+    0x00, 0xE0, 0x00, 0x02, 0xDF, 0x01, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x02, 0xDF, 0x01, 0x01, 0xA6,
+    0x00, 0xA0, 0x00, 0x01, 0x05, 0x00, 0xE0, 0x00, 0x00, 0x01, 0x59, 0x01, 0x01, 0xA6, 0x00, 0xA0,
+    0x00, 0x03, 0x55, 0x00, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x01, 0x06, 0x00, 0x01, 0xA6, 0x00, 0xA0,
+    0x00, 0x03, 0x37, 0x02, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x03, 0x09, 0x01, 0x01, 0xA6, 0x00, 0xA0,
+    0x00, 0x03, 0x2B, 0x03, 0xE0, 0x00, 0x00, 0x01, 0x04, 0x00, 0x60, 0x00, 0x67, 0x00, 0x85, 0x0B,
+    0xA6, 0x00, 0x8A, 0x0B, 0x00, 0xA0, 0x00, 0x02, 0x09, 0x00, 0xA0, 0x00, 0x00, 0x03, 0x3B, 0x02,
+    0xE0, 0x00, 0x00, 0x02, 0x5B, 0x00, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00,
+    0x00, 0x03, 0x86, 0x02, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x03, 0x86, 0x02, 0xE0, 0x00, 0x00, 0x03,
+    0x34, 0x03, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x03, 0x34, 0x03, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x03,
+    0x19, 0x03, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x03, 0xF2, 0x02, 0xA0, 0x00, 0x00, 0x01, 0x11, 0x00,
+    0x01, 0xA6, 0x00, 0xA0, 0x00, 0x02, 0x04, 0x00, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x02, 0xB4, 0x00,
+    0xA0, 0x00, 0x00, 0x04, 0xD2, 0x02, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x04, 0xFA, 0x00, 0x60, 0x00,
+    0x72, 0x00, 0xF9, 0x0B, 0xA6, 0x00, 0xFE, 0x0B, 0x00, 0xA0, 0x00, 0x01, 0x02, 0x00, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x73, 0x00, 0x0F, 0x0C, 0xA6, 0x00, 0x14, 0x0C, 0x00, 0xA0,
+    0x00, 0x01, 0x08, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x61, 0x00, 0x29, 0x0C,
+    0x6F, 0x00, 0x2E, 0x0C, 0xA6, 0x00, 0x34, 0x0C, 0x00, 0xA0, 0x00, 0x02, 0x77, 0x00, 0xA0, 0x00,
+    0x00, 0x02, 0x77, 0x00, 0xA0, 0x00, 0x00, 0x02, 0x96, 0x00, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x03,
+    0x16, 0x03, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x02, 0x57, 0x03, 0xA0, 0x00, 0x00, 0x02, 0x43, 0x00,
+    0xE0, 0x00, 0x00, 0x02, 0x06, 0x00, 0x01, 0xA6, 0x00, 0xA0, 0x00, 0x02, 0x06, 0x00, 0xE0, 0x00,
+    0x00, 0x01, 0x64, 0x03, 0x01, 0xA2, 0x00, 0xA0, 0x00, 0x01, 0x64, 0x03, 0xA0, 0x00, 0x40, 0x01,
+    0xDE, 0x02, 0xA0, 0x00, 0x00, 0x04, 0xDE, 0x02, 0xA0, 0x00, 0x00, 0x03, 0x11, 0x00, 0xA0, 0x00,
+    0x00, 0x01, 0x64, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x64, 0x00, 0xA0, 0x00, 0x06,
+    0xDA, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x90, 0x00, 0x00, 0x02, 0x59, 0x03,
+    0x94, 0x04, 0x00, 0x03, 0x49, 0x03, 0x20, 0x05, 0x00, 0x04, 0x42, 0x02, 0xBE, 0x05, 0x00, 0x03,
+    0x25, 0x03, 0x9A, 0x0B, 0x01, 0x02, 0x55, 0x03, 0x16, 0x0C, 0x00, 0x04, 0x66, 0x02, 0x01, 0x6F,
+    0x20, 0x00, 0x81, 0x00, 0x12, 0x05, 0x01, 0x0A, 0x29, 0x00, 0x83, 0x00, 0x8C, 0x04, 0x00, 0x02,
+    0x44, 0x02, 0x20, 0x05, 0x00, 0x02, 0x5B, 0x03, 0x00, 0x0C, 0x00, 0x04, 0x8A, 0x02
+};
+
+// Unique match payloads, indexed by the matches in the trie
+#if TRIE_PAYLOAD_INDEX_SIZE > 0
+static const uint8_t sequence_transform_payloads[TRIE_PAYLOADS_SIZE] PROGMEM = {
+
+};
+#endif
+
+static const uint8_t sequence_transform_completions_data[COMPLETIONS_SIZE] PROGMEM = {
+    0x75, 0x6C, 0x74, 0x61, 0x6E, 0x65, 0x6F, 0x75, 0x73, 0x6C, 0x79, 0x2D, 0x74, 0x72, 0x61, 0x6E,
+    0x73, 0x66, 0x6F, 0x72, 0x6D, 0x32, 0x30, 0x32, 0x34, 0x2D, 0x30, 0x34, 0x2D, 0x83, 0x82, 0x5F,
+    0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F,
+    0x72, 0x6D, 0x80, 0x65, 0x73, 0x74, 0x61, 0x75, 0x72, 0x61, 0x6E, 0x74, 0x65, 0x79, 0x5F, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x65, 0x73, 0x74, 0x65, 0x72, 0x64, 0x61, 0x79, 0x69, 0x66, 0x66,
+    0x69, 0x63, 0x75, 0x6C, 0x74, 0x6F, 0x6D, 0x65, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x6F, 0x6D, 0x65,
+    0x74, 0x69, 0x6D, 0x65, 0x73, 0x6F, 0x6D, 0x65, 0x77, 0x68, 0x65, 0x72, 0x65, 0x75, 0x61, 0x72,
+    0x61, 0x6E, 0x74, 0x65, 0x65, 0x65, 0x69, 0x67, 0x68, 0x62, 0x6F, 0x72, 0x65, 0x6D, 0x65, 0x6D,
+    0x62, 0x65, 0x72, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x65, 0x79, 0x70, 0x72, 0x65, 0x73,
+    0x73, 0x6E, 0x63, 0x72, 0x65, 0x61, 0x73, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x73, 0x74, 0x6F,
+    0x73, 0x73, 0x69, 0x62, 0x6C, 0x65, 0x70, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x65, 0x72, 0x69, 0x67,
+    0x69, 0x6E, 0x61, 0x6C, 0x72, 0x6F, 0x62, 0x61, 0x62, 0x6C, 0x65, 0x78, 0x65, 0x72, 0x63, 0x69,
+    0x73, 0x65, 0x62, 0x73, 0x65, 0x72, 0x76, 0x65, 0x63, 0x69, 0x65, 0x6E, 0x63, 0x65, 0x65, 0x6E,
+    0x65, 0x72, 0x61, 0x6C, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70,
+    0x67, 0x61, 0x69, 0x6E, 0x73, 0x74, 0x68, 0x6F, 0x75, 0x67, 0x68, 0x74, 0x68, 0x72, 0x6F, 0x75,
+    0x67, 0x68, 0x6C, 0x72, 0x65, 0x61, 0x64, 0x79, 0x6C, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6E, 0x63,
+    0x6C, 0x75, 0x64, 0x65, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x6F, 0x6D, 0x65, 0x68, 0x6F, 0x77,
+    0x6F, 0x6D, 0x65, 0x6F, 0x6E, 0x65, 0x6F, 0x77, 0x65, 0x76, 0x65, 0x72, 0x70, 0x65, 0x63, 0x69,
+    0x61, 0x6C, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x72, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x73, 0x6F,
+    0x6C, 0x75, 0x74, 0x65, 0x75, 0x61, 0x6C, 0x69, 0x74, 0x79, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73,
+    0x78, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x61, 0x73, 0x6E, 0x27, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x62, 0x6A, 0x65, 0x63, 0x74, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x63, 0x61, 0x75, 0x73, 0x65, 0x63,
+    0x68, 0x6F, 0x6F, 0x6C, 0x65, 0x63, 0x69, 0x64, 0x65, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x65, 0x66,
+    0x6F, 0x72, 0x65, 0x65, 0x6C, 0x6C, 0x6F, 0x77, 0x65, 0x6F, 0x70, 0x6C, 0x65, 0x65, 0x72, 0x65,
+    0x27, 0x73, 0x65, 0x72, 0x73, 0x6F, 0x6E, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x68, 0x61, 0x6E, 0x67,
+    0x65, 0x68, 0x61, 0x74, 0x27, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72,
+    0x69, 0x74, 0x74, 0x6C, 0x65, 0x6C, 0x65, 0x64, 0x67, 0x65, 0x6C, 0x69, 0x65, 0x76, 0x65, 0x6C,
+    0x77, 0x61, 0x79, 0x73, 0x6E, 0x6F, 0x75, 0x67, 0x68, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x6F, 0x6C,
+    0x6F, 0x67, 0x79, 0x6F, 0x76, 0x65, 0x72, 0x6E, 0x70, 0x64, 0x61, 0x74, 0x65, 0x70, 0x6C, 0x65,
+    0x74, 0x65, 0x70, 0x70, 0x65, 0x61, 0x72, 0x72, 0x65, 0x6E, 0x27, 0x74, 0x72, 0x6F, 0x75, 0x6E,
+    0x64, 0x73, 0x70, 0x61, 0x63, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x75, 0x62, 0x6C, 0x69, 0x63,
+    0x75, 0x6D, 0x62, 0x65, 0x72, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x78, 0x70, 0x65, 0x72, 0x74, 0x78,
+    0x79, 0x67, 0x65, 0x6E, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x49, 0x27,
+    0x6C, 0x6C, 0x49, 0x27, 0x76, 0x65, 0x61, 0x6E, 0x27, 0x74, 0x61, 0x72, 0x67, 0x65, 0x62, 0x6C,
+    0x65, 0x6D, 0x63, 0x63, 0x75, 0x72, 0x63, 0x6F, 0x6D, 0x65, 0x65, 0x27, 0x6C, 0x6C, 0x65, 0x27,
+    0x72, 0x65, 0x65, 0x27, 0x76, 0x65, 0x65, 0x61, 0x63, 0x68, 0x65, 0x61, 0x76, 0x65, 0x65, 0x63,
+    0x68, 0x6E, 0x65, 0x72, 0x65, 0x80, 0x65, 0x79, 0x27, 0x64, 0x66, 0x74, 0x65, 0x6E, 0x66, 0x74,
+    0x65, 0x72, 0x67, 0x72, 0x61, 0x6D, 0x68, 0x69, 0x6C, 0x64, 0x68, 0x72, 0x6F, 0x77, 0x69, 0x63,
+    0x61, 0x6C, 0x69, 0x65, 0x6E, 0x64, 0x69, 0x6D, 0x65, 0x80, 0x69, 0x6E, 0x63, 0x65, 0x69, 0x71,
+    0x75, 0x65, 0x69, 0x72, 0x73, 0x74, 0x6C, 0x61, 0x63, 0x65, 0x6D, 0x61, 0x6C, 0x6C, 0x6D, 0x65,
+    0x6E, 0x74, 0x6E, 0x64, 0x65, 0x72, 0x6F, 0x69, 0x6E, 0x74, 0x6F, 0x6D, 0x65, 0x80, 0x6F, 0x6E,
+    0x27, 0x74, 0x6F, 0x72, 0x6C, 0x64, 0x6F, 0x75, 0x73, 0x65, 0x6F, 0x77, 0x65, 0x72, 0x71, 0x75,
+    0x61, 0x6C, 0x72, 0x64, 0x65, 0x72, 0x72, 0x65, 0x61, 0x74, 0x72, 0x69, 0x74, 0x65, 0x72, 0x6F,
+    0x75, 0x70, 0x72, 0x6F, 0x77, 0x64, 0x73, 0x77, 0x65, 0x72, 0x73, 0x79, 0x63, 0x68, 0x74, 0x61,
+    0x74, 0x65, 0x74, 0x69, 0x6C, 0x6C, 0x75, 0x61, 0x67, 0x65, 0x75, 0x64, 0x67, 0x65, 0x75, 0x65,
+    0x73, 0x74, 0x75, 0x69, 0x63, 0x6B, 0x75, 0x72, 0x73, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x62, 0x75, 0x74, 0x49, 0x27, 0x64, 0x49, 0x27, 0x6D, 0x61, 0x63, 0x6B, 0x61,
+    0x63, 0x74, 0x61, 0x6B, 0x65, 0x61, 0x72, 0x64, 0x61, 0x72, 0x6B, 0x61, 0x73, 0x74, 0x65, 0x27,
+    0x64, 0x65, 0x61, 0x6C, 0x65, 0x65, 0x64, 0x65, 0x65, 0x70, 0x65, 0x6C, 0x70, 0x65, 0x72, 0x6D,
+    0x66, 0x75, 0x6C, 0x69, 0x63, 0x68, 0x69, 0x65, 0x77, 0x69, 0x6B, 0x65, 0x69, 0x6C, 0x65, 0x69,
+    0x6E, 0x64, 0x69, 0x6E, 0x6B, 0x69, 0x73, 0x80, 0x69, 0x74, 0x68, 0x69, 0x76, 0x65, 0x6C, 0x61,
+    0x79, 0x6C, 0x73, 0x6F, 0x6E, 0x6F, 0x77, 0x6F, 0x6F, 0x64, 0x6F, 0x6F, 0x6B, 0x6F, 0x72, 0x6B,
+    0x6F, 0x73, 0x74, 0x6F, 0x75, 0x74, 0x72, 0x6C, 0x79, 0x73, 0x65, 0x80, 0x75, 0x63, 0x68, 0x75,
+    0x73, 0x74, 0x76, 0x65, 0x6E, 0x49, 0x80, 0x68, 0x79, 0x6E, 0x80, 0x72, 0x80, 0x75, 0x6F, 0x77,
+    0x6E, 0x2E, 0x3E, 0x5C, 0x81
+};
+
+// Same completions, canonical Huffman coded
+#if COMPLETIONS_HUFFMAN_SIZE > 0
+static const uint8_t sequence_transform_completions_huffman[COMPLETIONS_HUFFMAN_SIZE] PROGMEM = {
+    0xA4, 0x92, 0x50, 0xD5, 0x09, 0xDF, 0xC4, 0xB9, 0x2C, 0x6C, 0xCF, 0x9F, 0xC7, 0xDF, 0xF1, 0xF9,
+    0xF8, 0xFB, 0xFE, 0x7E, 0x3F, 0xBF, 0xCF, 0xD4, 0xB9, 0x2C, 0x6C, 0xCF, 0x99, 0x72, 0x58, 0xD9,
+    0x9F, 0x3E, 0x08, 0x92, 0xA7, 0x25, 0x91, 0xDF, 0xEB, 0x5A, 0xDB, 0x60, 0xE2, 0x24, 0x3D, 0xCB,
+    0xB3, 0xDB, 0x63, 0xB5, 0x24, 0xB6, 0x44, 0xE0, 0xD7, 0x76, 0xC8, 0x93, 0xC8, 0x86, 0xC8, 0xEB,
+    0x01, 0xC5, 0x13, 0x92, 0xC8, 0x00, 0xF7, 0xC6, 0xAC, 0xE3, 0x23, 0x3A, 0x87, 0x1F, 0x34, 0x16,
+    0xC0, 0x77, 0xC3, 0x88, 0x85, 0xB3, 0x82, 0x80, 0xB2, 0x1C, 0x44, 0xB4, 0x41, 0xEA, 0x83, 0x8E,
+    0x1A, 0x0E, 0x43, 0x9E, 0xE6, 0xA4, 0x8E, 0xDA, 0x96, 0xA8, 0x3E, 0x83, 0xD8, 0xE0, 0x6B, 0x01,
+    0xF9, 0x16, 0x30, 0xB6, 0x01, 0x43, 0x92, 0x07, 0x83, 0x65, 0x1C, 0x84, 0x6E, 0x37, 0x23, 0x58,
+    0x9C, 0x35, 0x6F, 0x89, 0xC3, 0xB5, 0x6F, 0x84, 0x70, 0x57, 0xED, 0x1C, 0xF7, 0xC4, 0xAD, 0x92,
+    0xAE, 0x16, 0x0E, 0xE1, 0xDB, 0x23, 0x0D, 0xD3, 0x64, 0x32, 0x86, 0xE8, 0x72, 0x1F, 0x81, 0x63,
+    0x24, 0xE3, 0x77, 0x2B, 0x87, 0x69, 0xC0, 0x78, 0x64, 0xA9, 0x14, 0x48, 0x73, 0xDD, 0x5A, 0xC2,
+    0x23, 0xE8, 0xB3, 0xC2, 0x02, 0x85, 0xD2, 0x4A, 0x4D, 0x97, 0x5F, 0xFC, 0x5A, 0x75, 0x70, 0x5E,
+    0xEC, 0x55, 0x02, 0xD8, 0x66, 0x41, 0x63, 0xB8, 0x16, 0x67, 0xB8, 0xD9, 0x9C, 0x04, 0x46, 0xE8,
+    0x37, 0x08, 0x03, 0x8D, 0x20, 0x3C, 0x32, 0x88, 0x0B, 0x38, 0x25, 0xDC, 0x60, 0xA7, 0x48, 0xC3,
+    0x52, 0x5C, 0xF6, 0xD8, 0x39, 0xCC, 0xA0, 0x41, 0x7D, 0xC2, 0x18, 0xE4, 0x27, 0x45, 0xDC, 0x2B,
+    0x56, 0xF8, 0x64, 0x46, 0xE9, 0x91, 0xB7, 0xED, 0xB9, 0x0E, 0xBC, 0x5C, 0xA4, 0x70, 0x82, 0x47,
+    0x1C, 0x02, 0x77, 0x0B, 0xA4, 0xBB, 0x52, 0xDE, 0x38, 0x2B, 0x09, 0xE8, 0x05, 0xAD, 0x50, 0xED,
+    0x59, 0xD4, 0x3D, 0x39, 0xAE, 0xFF, 0x5C, 0x07, 0x9F, 0xAE, 0xF7, 0x0B, 0xDE, 0x75, 0x64, 0xEE,
+    0x24, 0x67, 0xD6, 0x88, 0x9E, 0xB4, 0xE4, 0x12, 0xE9, 0x24, 0xFB, 0x8D, 0x50, 0x66, 0xD6, 0xA7,
+    0xB3, 0x64, 0x0D, 0x11, 0x06, 0x8E, 0x06, 0x9C, 0x80, 0x56, 0xC0, 0x2E, 0x40, 0xB6, 0x14, 0x38,
+    0xF0, 0x77, 0xA5, 0xF6, 0x90, 0xBB, 0x48, 0x7D, 0xDC, 0xB3, 0x83, 0x4B, 0xE1, 0xDB, 0xA3, 0xB1,
+    0x21, 0x85, 0xB9, 0xE4, 0x78, 0x6B, 0x60, 0x7F, 0x34, 0x0D, 0xE2, 0x50, 0xAC, 0x32, 0x48, 0x99,
+    0x0B, 0x2B, 0x70, 0xEC, 0x6B, 0x2D, 0x91, 0xE3, 0x2E, 0x92, 0xCE, 0x97, 0x6A, 0x80, 0xDD, 0x07,
+    0xF9, 0xA2, 0x47, 0xB8, 0x77, 0x05, 0x2E, 0x72, 0x1D, 0xAB, 0x87, 0x6E, 0xAF, 0x1D, 0x07, 0x8E,
+    0xED, 0x89, 0x29, 0x12, 0x68, 0x94, 0x5B, 0x8A, 0xBE, 0xE2, 0x84, 0x4D, 0x1D, 0xBD, 0xD3, 0xC0,
+    0xE4, 0x3F, 0x7F, 0x62, 0x5B, 0xFD, 0xB5, 0xA9, 0xF5, 0xA5, 0xFD, 0x69, 0x92, 0xB7, 0xB2, 0xB4,
+    0x97, 0xB0, 0x4F, 0x72, 0x7F, 0x65, 0x12, 0x34, 0xB8, 0x24, 0x02, 0xE0, 0x70, 0x13, 0x80, 0xF9,
+    0xDA, 0x90, 0xED, 0x83, 0x1D, 0x1F, 0xB0, 0x68, 0x0D, 0x6E, 0x6B, 0xEC, 0xE3, 0xC3, 0x9C, 0x1F,
+    0x21, 0x0B, 0xB4, 0x86, 0x56, 0xE9, 0x9A, 0xEC, 0xDE, 0xD9, 0xFD, 0xB4, 0x4B, 0x54, 0xBA, 0x77,
+    0x03, 0xCA, 0xB6, 0x2A, 0x27, 0x90, 0xBE, 0xBC, 0xC7, 0x6B, 0xE3, 0xF9, 0x4D, 0xD2, 0xFF, 0x9F,
+    0xEF, 0xFD, 0xFB
+};
+
+static const uint8_t sequence_transform_completion_code_counts[COMPLETION_CODE_MAX_LENGTH] PROGMEM = {
+    0x00, 0x00, 0x01, 0x09, 0x04, 0x09, 0x02, 0x03, 0x08, 0x04
+};
+
+static const uint8_t sequence_transform_completion_code_symbols[COMPLETION_CODE_SYMBOL_COUNT] PROGMEM = {
+    0x65, 0x61, 0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x63, 0x64, 0x68, 0x6D, 0x27, 0x62,
+    0x66, 0x67, 0x70, 0x76, 0x77, 0x79, 0x80, 0x49, 0x6B, 0x2D, 0x71, 0x78, 0x20, 0x30, 0x32, 0x34,
+    0x5F, 0x81, 0x82, 0x83, 0x2E, 0x3E, 0x5C, 0x6A
+};
+
+static const uint32_t sequence_transform_completion_checkpoints[COMPLETION_CHECKPOINT_COUNT] PROGMEM = {
+    0x00000000, 0x00000045, 0x000000BD, 0x00000102, 0x0000014C, 0x00000194, 0x000001D8, 0x00000219,
+    0x0000025B, 0x000002A0, 0x000002DD, 0x00000323, 0x0000036A, 0x000003AA, 0x000003EA, 0x00000431,
+    0x0000047A, 0x000004BD, 0x00000500, 0x00000544, 0x00000586, 0x000005CE, 0x0000061B, 0x0000065E,
+    0x0000069C, 0x000006DE, 0x00000725, 0x00000765, 0x000007AE, 0x000007F6, 0x00000839, 0x0000087F,
+    0x000008CC, 0x0000091B, 0x00000966, 0x000009AB, 0x000009ED, 0x00000A35, 0x00000A7D, 0x00000AC3,
+    0x00000B03, 0x00000B45, 0x00000B8C, 0x00000BCA, 0x00000C14, 0x00000C55, 0x00000CA0, 0x00000CF8,
+    0x00000D40, 0x00000D80, 0x00000DC6, 0x00000E0E, 0x00000E59, 0x00000E9E, 0x00000EED
+};
+#endif
+
+static const uint8_t sequence_transform_trigger_keys[32] PROGMEM = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+static const uint8_t sequence_transform_trigger_pair_index[256] PROGMEM = {
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x04, 0x03,
+    0x02, 0x02, 0x02, 0x02, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02
+};
+
+static const uint8_t sequence_transform_trigger_pair_rows[TRIGGER_PAIR_ROWS_SIZE] PROGMEM = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
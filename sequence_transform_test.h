@@ -0,0 +1,885 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was generated from rules with content hash 4f5dd5a675add501.
+// Do not edit this file directly!
+
+#pragma once
+
+static const uint8_t *st_test_sequences[] = {
+    (uint8_t[3]){ 0xA7, 0x81, 0x00 },
+    (uint8_t[3]){ 0xA2, 0x80, 0x00 },
+    (uint8_t[3]){ 0xA2, 0x6E, 0x00 },
+    (uint8_t[3]){ 0xA2, 0x81, 0x00 },
+    (uint8_t[3]){ 0x71, 0x61, 0x00 },
+    (uint8_t[3]){ 0x71, 0x69, 0x00 },
+    (uint8_t[3]){ 0x71, 0x65, 0x00 },
+    (uint8_t[3]){ 0x71, 0x6F, 0x00 },
+    (uint8_t[3]){ 0x64, 0x82, 0x00 },
+    (uint8_t[3]){ 0xA6, 0x6E, 0x00 },
+    (uint8_t[3]){ 0xA6, 0x80, 0x00 },
+    (uint8_t[3]){ 0x76, 0x80, 0x00 },
+    (uint8_t[3]){ 0x73, 0x80, 0x00 },
+    (uint8_t[3]){ 0x78, 0x80, 0x00 },
+    (uint8_t[3]){ 0x6D, 0x80, 0x00 },
+    (uint8_t[3]){ 0x74, 0x80, 0x00 },
+    (uint8_t[3]){ 0x6B, 0x80, 0x00 },
+    (uint8_t[3]){ 0x6C, 0x80, 0x00 },
+    (uint8_t[3]){ 0x72, 0x80, 0x00 },
+    (uint8_t[3]){ 0x6A, 0x80, 0x00 },
+    (uint8_t[3]){ 0x63, 0x80, 0x00 },
+    (uint8_t[3]){ 0x70, 0x80, 0x00 },
+    (uint8_t[3]){ 0x64, 0x80, 0x00 },
+    (uint8_t[3]){ 0x79, 0x80, 0x00 },
+    (uint8_t[3]){ 0x67, 0x80, 0x00 },
+    (uint8_t[3]){ 0x77, 0x80, 0x00 },
+    (uint8_t[3]){ 0x71, 0x80, 0x00 },
+    (uint8_t[3]){ 0x62, 0x80, 0x00 },
+    (uint8_t[3]){ 0x66, 0x80, 0x00 },
+    (uint8_t[3]){ 0x7A, 0x80, 0x00 },
+    (uint8_t[3]){ 0x6E, 0x80, 0x00 },
+    (uint8_t[3]){ 0x68, 0x80, 0x00 },
+    (uint8_t[3]){ 0x75, 0x80, 0x00 },
+    (uint8_t[3]){ 0x65, 0x80, 0x00 },
+    (uint8_t[3]){ 0x6F, 0x80, 0x00 },
+    (uint8_t[3]){ 0x61, 0x80, 0x00 },
+    (uint8_t[3]){ 0x2C, 0x80, 0x00 },
+    (uint8_t[3]){ 0x69, 0x80, 0x00 },
+    (uint8_t[3]){ 0x2E, 0x80, 0x00 },
+    (uint8_t[3]){ 0x2D, 0x80, 0x00 },
+    (uint8_t[3]){ 0x3D, 0x80, 0x00 },
+    (uint8_t[3]){ 0xA6, 0x81, 0x00 },
+    (uint8_t[3]){ 0x61, 0x81, 0x00 },
+    (uint8_t[3]){ 0x78, 0x81, 0x00 },
+    (uint8_t[3]){ 0x6B, 0x81, 0x00 },
+    (uint8_t[3]){ 0x69, 0x81, 0x00 },
+    (uint8_t[3]){ 0x79, 0x81, 0x00 },
+    (uint8_t[3]){ 0x71, 0x81, 0x00 },
+    (uint8_t[3]){ 0x6A, 0x81, 0x00 },
+    (uint8_t[3]){ 0x63, 0x81, 0x00 },
+    (uint8_t[3]){ 0x6E, 0x81, 0x00 },
+    (uint8_t[3]){ 0x68, 0x81, 0x00 },
+    (uint8_t[3]){ 0xA4, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA2, 0xA2, 0x81, 0x00 },
+    (uint8_t[4]){ 0x67, 0x68, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x6B, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x71, 0x61, 0x00 },
+    (uint8_t[4]){ 0x71, 0x61, 0x80, 0x00 },
+    (uint8_t[4]){ 0x71, 0x69, 0x80, 0x00 },
+    (uint8_t[4]){ 0x71, 0x65, 0x80, 0x00 },
+    (uint8_t[4]){ 0x71, 0x6F, 0x80, 0x00 },
+    (uint8_t[4]){ 0x71, 0x6D, 0x80, 0x00 },
+    (uint8_t[4]){ 0x64, 0x82, 0x74, 0x00 },
+    (uint8_t[4]){ 0x64, 0x82, 0x72, 0x00 },
+    (uint8_t[4]){ 0x64, 0x82, 0x64, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x69, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x63, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x72, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x6C, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x6D, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x6E, 0xA7, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x6E, 0x65, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x6E, 0x80, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x6E, 0x72, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x6E, 0x69, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x6E, 0x67, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x6E, 0x6B, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x6E, 0x79, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x6E, 0x64, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x6E, 0x73, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x6E, 0x74, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x6E, 0x61, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x6E, 0x6F, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x6E, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x74, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x74, 0x80, 0x00 },
+    (uint8_t[4]){ 0x6B, 0x81, 0x64, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x6B, 0x80, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x6F, 0x81, 0x00 },
+    (uint8_t[4]){ 0x6F, 0x75, 0x81, 0x00 },
+    (uint8_t[4]){ 0x61, 0x75, 0x81, 0x00 },
+    (uint8_t[4]){ 0x73, 0x74, 0x81, 0x00 },
+    (uint8_t[4]){ 0x72, 0x73, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x62, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x66, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x80, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x65, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x77, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x77, 0x80, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x76, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x61, 0x80, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x61, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x73, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x73, 0x80, 0x00 },
+    (uint8_t[4]){ 0x73, 0x80, 0x6C, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x70, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x70, 0x80, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x64, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x75, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x68, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x67, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x79, 0x81, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x6C, 0x80, 0x00 },
+    (uint8_t[4]){ 0x76, 0x80, 0x80, 0x00 },
+    (uint8_t[4]){ 0x6D, 0x61, 0x80, 0x00 },
+    (uint8_t[4]){ 0x6D, 0x72, 0x80, 0x00 },
+    (uint8_t[4]){ 0x74, 0x61, 0x80, 0x00 },
+    (uint8_t[4]){ 0x6C, 0x69, 0x80, 0x00 },
+    (uint8_t[4]){ 0x72, 0x80, 0x80, 0x00 },
+    (uint8_t[4]){ 0x6A, 0x80, 0x80, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x6A, 0x81, 0x00 },
+    (uint8_t[4]){ 0x63, 0x80, 0x80, 0x00 },
+    (uint8_t[4]){ 0x70, 0x80, 0x80, 0x00 },
+    (uint8_t[4]){ 0x70, 0x6C, 0x80, 0x00 },
+    (uint8_t[4]){ 0x70, 0x61, 0x80, 0x00 },
+    (uint8_t[4]){ 0x64, 0x80, 0x80, 0x00 },
+    (uint8_t[4]){ 0x64, 0x61, 0x80, 0x00 },
+    (uint8_t[4]){ 0x64, 0x72, 0x80, 0x00 },
+    (uint8_t[4]){ 0x79, 0x80, 0x80, 0x00 },
+    (uint8_t[4]){ 0x67, 0x80, 0x80, 0x00 },
+    (uint8_t[4]){ 0x71, 0x80, 0x80, 0x00 },
+    (uint8_t[4]){ 0x71, 0x80, 0x64, 0x00 },
+    (uint8_t[4]){ 0x75, 0x80, 0x80, 0x00 },
+    (uint8_t[4]){ 0x65, 0x80, 0x80, 0x00 },
+    (uint8_t[5]){ 0xA2, 0xA2, 0x81, 0x64, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x81, 0x71, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x74, 0x81, 0x6F, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x81, 0x6C, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6B, 0x81, 0x72, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6B, 0x81, 0x62, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x71, 0x61, 0x80, 0x00 },
+    (uint8_t[5]){ 0x73, 0x69, 0x6D, 0x80, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x69, 0x81, 0xA6, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x69, 0x81, 0x6D, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x69, 0x81, 0x64, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x69, 0x81, 0x6C, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x69, 0x81, 0x76, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x69, 0x81, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x69, 0x81, 0x73, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x69, 0x81, 0x65, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x69, 0x81, 0x72, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x63, 0x81, 0x69, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x63, 0x81, 0x72, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x63, 0x81, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x63, 0x81, 0x76, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x63, 0x81, 0x6F, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x63, 0x81, 0x61, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x63, 0x81, 0x65, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x63, 0x81, 0x6E, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x63, 0x81, 0x6D, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x63, 0x81, 0x6C, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x63, 0x81, 0x68, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x63, 0x81, 0x75, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x77, 0x81, 0x75, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x81, 0x75, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x72, 0x81, 0x64, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x72, 0x81, 0x79, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x72, 0x81, 0x69, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x72, 0x81, 0x65, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x72, 0x81, 0x6D, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x72, 0x81, 0x63, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x72, 0x81, 0x68, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6C, 0x81, 0x67, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6C, 0x81, 0x69, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6C, 0x81, 0x61, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6C, 0x81, 0x6F, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6C, 0x81, 0x66, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6C, 0x81, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6C, 0x81, 0x6E, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6C, 0x81, 0x76, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6D, 0x81, 0x67, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6D, 0x81, 0x69, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6D, 0x81, 0x6F, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6D, 0x81, 0x65, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6D, 0x81, 0x75, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6D, 0x81, 0x63, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6D, 0x81, 0x76, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6D, 0x81, 0x6E, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6D, 0x81, 0x72, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6E, 0x72, 0x6D, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6E, 0x72, 0xA7, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6E, 0x72, 0xA6, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6E, 0x72, 0x73, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6E, 0x69, 0x6E, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6E, 0x79, 0x72, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6E, 0x79, 0x6C, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6E, 0x73, 0xA6, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6E, 0x73, 0x65, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6E, 0x74, 0x73, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6E, 0x61, 0xA6, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6E, 0x61, 0x6B, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6E, 0x6F, 0xA6, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6E, 0x6F, 0x75, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6E, 0x6F, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6E, 0x6F, 0x72, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x74, 0x81, 0xA6, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x74, 0x81, 0x67, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x74, 0x81, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x74, 0x81, 0x72, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x74, 0x81, 0x6E, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x74, 0x81, 0x77, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x74, 0x81, 0x61, 0x00 },
+    (uint8_t[5]){ 0x6B, 0x81, 0x64, 0x69, 0x00 },
+    (uint8_t[5]){ 0x6B, 0x81, 0x64, 0x64, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6B, 0x81, 0x64, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6F, 0x81, 0x78, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6F, 0x81, 0x72, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6F, 0x81, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6F, 0x81, 0x62, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6F, 0x81, 0x76, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6F, 0x81, 0x70, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6F, 0x81, 0x67, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6F, 0x81, 0x63, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6F, 0x81, 0x66, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6F, 0x81, 0x64, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x62, 0x81, 0x6F, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x62, 0x81, 0x73, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x62, 0x81, 0x63, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x62, 0x81, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x62, 0x81, 0x6B, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x62, 0x81, 0x67, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x62, 0x81, 0x6C, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x62, 0x81, 0x65, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x62, 0x81, 0x72, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x62, 0x81, 0x75, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x66, 0x81, 0x6C, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x66, 0x81, 0x72, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x66, 0x81, 0x64, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x66, 0x81, 0x65, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x66, 0x81, 0x63, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x66, 0x81, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x80, 0x81, 0x76, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x80, 0x81, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x80, 0x81, 0x64, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x80, 0x81, 0x77, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x80, 0x81, 0x67, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x80, 0x81, 0x6D, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x80, 0x81, 0x72, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x65, 0x81, 0x67, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x65, 0x81, 0x6E, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x65, 0x81, 0x79, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x65, 0x81, 0x72, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x65, 0x81, 0x78, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x65, 0x81, 0x63, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x65, 0x81, 0x70, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x65, 0x81, 0x71, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x77, 0x81, 0x69, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x77, 0x81, 0x6E, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x77, 0x81, 0x68, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x77, 0x81, 0x65, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x77, 0x81, 0x61, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x77, 0x81, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x77, 0x81, 0x6F, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x77, 0x81, 0x6B, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x77, 0x81, 0x72, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x77, 0x81, 0x64, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x77, 0x81, 0x6C, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x77, 0x81, 0x76, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x77, 0x80, 0x80, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x77, 0x80, 0x69, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x77, 0x80, 0x65, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x77, 0x80, 0x72, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x77, 0x80, 0x6F, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x77, 0x80, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x76, 0x81, 0x67, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x76, 0x81, 0x72, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x76, 0x81, 0x64, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x76, 0x81, 0x69, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x76, 0x81, 0x6E, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x61, 0x80, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x61, 0x80, 0x76, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x61, 0x80, 0x64, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x61, 0x80, 0x73, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x61, 0x80, 0x6C, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x61, 0x81, 0x72, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x61, 0x81, 0x80, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x61, 0x81, 0x64, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x61, 0x81, 0x6E, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x61, 0x81, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x61, 0x81, 0x73, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x61, 0x81, 0x70, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x61, 0x81, 0x77, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x61, 0x81, 0x79, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x61, 0x81, 0x6C, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x81, 0xA7, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x81, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x81, 0x67, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x81, 0x68, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x81, 0x77, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x81, 0x6F, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x81, 0x79, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x81, 0x64, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x81, 0x63, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x81, 0x73, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x81, 0x6D, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x81, 0x70, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x81, 0x61, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x81, 0x65, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x81, 0x69, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x81, 0x6E, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x80, 0x63, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x80, 0x6C, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x70, 0x81, 0x62, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x70, 0x81, 0x6D, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x70, 0x81, 0x72, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x70, 0x81, 0x65, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x70, 0x81, 0x61, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x70, 0x81, 0x73, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x70, 0x81, 0x6E, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x70, 0x81, 0x6F, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x70, 0x81, 0x75, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x70, 0x81, 0x68, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x70, 0x81, 0x6C, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x70, 0x81, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x70, 0x80, 0x80, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x70, 0x80, 0x61, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x64, 0x81, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x64, 0x81, 0x69, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x64, 0x81, 0x73, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x64, 0x81, 0x66, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x64, 0x81, 0x75, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x64, 0x81, 0x72, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x64, 0x81, 0x6E, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x64, 0x81, 0x64, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x64, 0x81, 0x6C, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x75, 0x81, 0x69, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x75, 0x81, 0x66, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x75, 0x81, 0x72, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x75, 0x81, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x75, 0x81, 0x67, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x75, 0x81, 0x6E, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x68, 0x81, 0x67, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x68, 0x81, 0x65, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x68, 0x81, 0x72, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x68, 0x81, 0x73, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x68, 0x81, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x68, 0x81, 0x6C, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x68, 0x81, 0x64, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x67, 0x81, 0x69, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x67, 0x81, 0x76, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x67, 0x81, 0x65, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x67, 0x81, 0x72, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x67, 0x81, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x67, 0x81, 0x6F, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x67, 0x81, 0x75, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x67, 0x81, 0x61, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x79, 0x81, 0x65, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x79, 0x81, 0x6C, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x79, 0x81, 0x76, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x79, 0x81, 0x64, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x79, 0x81, 0x79, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x79, 0x81, 0x6F, 0x00 },
+    (uint8_t[5]){ 0x6D, 0x61, 0x80, 0x67, 0x00 },
+    (uint8_t[5]){ 0x74, 0x61, 0x80, 0x80, 0x00 },
+    (uint8_t[5]){ 0x74, 0x61, 0x80, 0x67, 0x00 },
+    (uint8_t[5]){ 0x6C, 0x6C, 0x69, 0x80, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6A, 0x81, 0x64, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x73, 0x81, 0x71, 0x6F, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x73, 0x81, 0x71, 0x2D, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x71, 0x75, 0x61, 0x80, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x71, 0x61, 0x80, 0x74, 0x00 },
+    (uint8_t[6]){ 0x73, 0x69, 0x6D, 0x80, 0x80, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x69, 0x81, 0x74, 0x73, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x69, 0x81, 0x73, 0x67, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x69, 0x81, 0x65, 0x67, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x69, 0x81, 0x72, 0x67, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x69, 0x81, 0x72, 0x64, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x63, 0x81, 0x61, 0x69, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x63, 0x81, 0x6E, 0x69, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x63, 0x81, 0x6D, 0x69, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x63, 0x81, 0x68, 0x72, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x73, 0x81, 0x75, 0x72, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x63, 0x81, 0x75, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x77, 0x81, 0x75, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x73, 0x81, 0x75, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x63, 0x81, 0x75, 0x76, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x77, 0x81, 0x75, 0x76, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x73, 0x81, 0x75, 0x76, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x72, 0x81, 0x65, 0x79, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x72, 0x81, 0x73, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x6C, 0x81, 0x6F, 0x67, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x74, 0x81, 0x6E, 0x79, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x74, 0x81, 0x6E, 0x6C, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x74, 0x81, 0x6E, 0x75, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x74, 0x81, 0x61, 0x67, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x6B, 0x81, 0x64, 0x69, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x6B, 0x81, 0x64, 0x64, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x6F, 0x81, 0x64, 0x69, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x62, 0x81, 0x6B, 0x61, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x66, 0x81, 0x6C, 0x80, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x66, 0x81, 0x6C, 0x64, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x65, 0x81, 0x79, 0x6D, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x65, 0x81, 0x79, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x65, 0x81, 0x71, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x77, 0x81, 0x74, 0x73, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x77, 0x81, 0x72, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x77, 0x80, 0x72, 0x6E, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x77, 0x80, 0x72, 0x69, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x77, 0x80, 0x6F, 0x6B, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x77, 0x80, 0x74, 0x6F, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x61, 0x81, 0x72, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x73, 0x81, 0x65, 0x73, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x73, 0x81, 0x65, 0x64, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x73, 0x81, 0x65, 0x6C, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x70, 0x80, 0x61, 0x79, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x64, 0x81, 0x69, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x64, 0x81, 0x73, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x64, 0x81, 0x66, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x64, 0x81, 0x6C, 0x6D, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x64, 0x81, 0x6C, 0x64, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x64, 0x81, 0x6C, 0x80, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x68, 0x81, 0x65, 0x73, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x68, 0x81, 0x65, 0x6C, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x68, 0x81, 0x65, 0x64, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x68, 0x81, 0x73, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x68, 0x81, 0x64, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x67, 0x81, 0x76, 0x64, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x67, 0x81, 0x76, 0x6D, 0x00 },
+    (uint8_t[6]){ 0x76, 0x69, 0x6C, 0x69, 0x80, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x6A, 0x81, 0x64, 0x74, 0x00 },
+    (uint8_t[7]){ 0x6A, 0x75, 0x64, 0x67, 0x65, 0x80, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x74, 0x81, 0x6E, 0x6C, 0x79, 0x00 },
+    (uint8_t[7]){ 0x62, 0x6C, 0x69, 0x76, 0x69, 0x80, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x6A, 0x81, 0x64, 0x74, 0x61, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x73, 0x81, 0x71, 0x20, 0x6F, 0xA6, 0x00 },
+    0
+};
+
+static const uint8_t *st_test_transforms[] = {
+    (uint8_t[3]){ 0xA7, 0x81, 0x00 },
+    (uint8_t[3]){ 0xA2, 0x2E, 0x00 },
+    (uint8_t[3]){ 0xA2, 0x6E, 0x00 },
+    (uint8_t[3]){ 0xA2, 0x81, 0x00 },
+    (uint8_t[4]){ 0x71, 0x75, 0x61, 0x00 },
+    (uint8_t[4]){ 0x71, 0x75, 0x69, 0x00 },
+    (uint8_t[4]){ 0x71, 0x75, 0x65, 0x00 },
+    (uint8_t[4]){ 0x71, 0x75, 0x6F, 0x00 },
+    (uint8_t[8]){ 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x74, 0x68, 0x00 },
+    (uint8_t[3]){ 0xA6, 0x6E, 0x00 },
+    (uint8_t[4]){ 0x76, 0x65, 0x72, 0x00 },
+    (uint8_t[3]){ 0x73, 0x6B, 0x00 },
+    (uint8_t[4]){ 0x78, 0x65, 0x73, 0x00 },
+    (uint8_t[5]){ 0x6D, 0x65, 0x6E, 0x74, 0x00 },
+    (uint8_t[6]){ 0x74, 0x6D, 0x65, 0x6E, 0x74, 0x00 },
+    (uint8_t[3]){ 0x6B, 0x73, 0x00 },
+    (uint8_t[3]){ 0x6C, 0x6B, 0x00 },
+    (uint8_t[3]){ 0x72, 0x6C, 0x00 },
+    (uint8_t[5]){ 0x6A, 0x75, 0x73, 0x74, 0x00 },
+    (uint8_t[3]){ 0x63, 0x79, 0x00 },
+    (uint8_t[3]){ 0x70, 0x79, 0x00 },
+    (uint8_t[3]){ 0x64, 0x79, 0x00 },
+    (uint8_t[3]){ 0x79, 0x70, 0x00 },
+    (uint8_t[3]){ 0x67, 0x79, 0x00 },
+    (uint8_t[4]){ 0x77, 0x61, 0x79, 0x00 },
+    (uint8_t[6]){ 0x71, 0x75, 0x65, 0x73, 0x74, 0x00 },
+    (uint8_t[7]){ 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x00 },
+    (uint8_t[6]){ 0x66, 0x69, 0x72, 0x73, 0x74, 0x00 },
+    (uint8_t[5]){ 0x7A, 0x6F, 0x6E, 0x65, 0x00 },
+    (uint8_t[5]){ 0x6E, 0x69, 0x6F, 0x6E, 0x00 },
+    (uint8_t[8]){ 0x68, 0x6F, 0x77, 0x65, 0x76, 0x65, 0x72, 0x00 },
+    (uint8_t[3]){ 0x75, 0x65, 0x00 },
+    (uint8_t[3]){ 0x65, 0x75, 0x00 },
+    (uint8_t[3]){ 0x6F, 0x61, 0x00 },
+    (uint8_t[3]){ 0x61, 0x6F, 0x00 },
+    (uint8_t[6]){ 0x2C, 0x20, 0x62, 0x75, 0x74, 0x00 },
+    (uint8_t[4]){ 0x69, 0x6F, 0x6E, 0x00 },
+    (uint8_t[3]){ 0x2E, 0x5C, 0x00 },
+    (uint8_t[3]){ 0x2D, 0x3E, 0x00 },
+    (uint8_t[3]){ 0x3D, 0x3E, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x66, 0x6F, 0x72, 0x00 },
+    (uint8_t[4]){ 0x61, 0x6E, 0x64, 0x00 },
+    (uint8_t[4]){ 0x78, 0x65, 0x72, 0x00 },
+    (uint8_t[5]){ 0x6B, 0x6E, 0x6F, 0x77, 0x00 },
+    (uint8_t[4]){ 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[4]){ 0x79, 0x6F, 0x75, 0x00 },
+    (uint8_t[6]){ 0x71, 0x75, 0x69, 0x63, 0x6B, 0x00 },
+    (uint8_t[5]){ 0x6A, 0x6F, 0x69, 0x6E, 0x00 },
+    (uint8_t[3]){ 0x63, 0x6B, 0x00 },
+    (uint8_t[3]){ 0x6E, 0x66, 0x00 },
+    (uint8_t[3]){ 0x68, 0x6E, 0x00 },
+    (uint8_t[6]){ 0xA4, 0x20, 0x61, 0x6E, 0x64, 0x00 },
+    (uint8_t[4]){ 0xA2, 0xA2, 0x81, 0x00 },
+    (uint8_t[5]){ 0x67, 0x68, 0x6C, 0x79, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x6B, 0x6E, 0x6F, 0x77, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x71, 0x75, 0x61, 0x00 },
+    (uint8_t[3]){ 0x71, 0x61, 0x00 },
+    (uint8_t[3]){ 0x71, 0x69, 0x00 },
+    (uint8_t[3]){ 0x71, 0x65, 0x00 },
+    (uint8_t[3]){ 0x71, 0x6F, 0x00 },
+    (uint8_t[4]){ 0x71, 0x6D, 0x6B, 0x00 },
+    (uint8_t[12]){ 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x6D, 0x65, 0x6E, 0x74, 0x00 },
+    (uint8_t[10]){ 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x65, 0x72, 0x00 },
+    (uint8_t[10]){ 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x65, 0x64, 0x00 },
+    (uint8_t[3]){ 0xA6, 0x69, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x63, 0x6F, 0x6D, 0x65, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x72, 0x69, 0x67, 0x68, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x6C, 0x69, 0x6B, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x6D, 0x61, 0x6B, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x74, 0x68, 0x65, 0x80, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x74, 0x68, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x74, 0x68, 0x65, 0x6E, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x74, 0x68, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x74, 0x68, 0x65, 0x69, 0x72, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x74, 0x68, 0x69, 0x6E, 0x6B, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x74, 0x68, 0x65, 0x79, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x74, 0x68, 0x65, 0x79, 0x27, 0x64, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x74, 0x68, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x74, 0x68, 0x61, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x74, 0x68, 0x61, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x74, 0x68, 0x6F, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x74, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00 },
+    (uint8_t[3]){ 0xA6, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x74, 0x65, 0x6C, 0x6C, 0x00 },
+    (uint8_t[10]){ 0x6B, 0x6E, 0x6F, 0x77, 0x6C, 0x65, 0x64, 0x67, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x6B, 0x65, 0x65, 0x70, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6F, 0x6E, 0x65, 0x00 },
+    (uint8_t[5]){ 0x6F, 0x75, 0x67, 0x68, 0x00 },
+    (uint8_t[5]){ 0x61, 0x75, 0x67, 0x68, 0x00 },
+    (uint8_t[4]){ 0x73, 0x74, 0x73, 0x00 },
+    (uint8_t[4]){ 0x72, 0x73, 0x74, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x62, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x66, 0x72, 0x6F, 0x6D, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x6E, 0x6F, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x65, 0x61, 0x63, 0x68, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x77, 0x68, 0x79, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x77, 0x61, 0x79, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x76, 0x69, 0x65, 0x77, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x61, 0x62, 0x6F, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x61, 0x6E, 0x64, 0x00 },
+    (uint8_t[3]){ 0xA6, 0x73, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x73, 0x6B, 0x00 },
+    (uint8_t[7]){ 0x73, 0x63, 0x68, 0x6F, 0x6F, 0x6C, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x70, 0x72, 0x6F, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x70, 0x79, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x64, 0x6F, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x75, 0x73, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x68, 0x61, 0x76, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x67, 0x69, 0x76, 0x65, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x79, 0x6F, 0x75, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x6C, 0x69, 0x74, 0x74, 0x6C, 0x65, 0x00 },
+    (uint8_t[5]){ 0x76, 0x65, 0x72, 0x6E, 0x00 },
+    (uint8_t[5]){ 0x6D, 0x61, 0x6B, 0x65, 0x00 },
+    (uint8_t[5]){ 0x6D, 0x61, 0x72, 0x6B, 0x00 },
+    (uint8_t[5]){ 0x74, 0x61, 0x6B, 0x65, 0x00 },
+    (uint8_t[5]){ 0x6C, 0x69, 0x73, 0x74, 0x00 },
+    (uint8_t[4]){ 0x72, 0x6C, 0x6E, 0x00 },
+    (uint8_t[9]){ 0x6A, 0x75, 0x73, 0x74, 0x6D, 0x65, 0x6E, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x6A, 0x6F, 0x69, 0x6E, 0x00 },
+    (uint8_t[4]){ 0x63, 0x79, 0x6E, 0x00 },
+    (uint8_t[4]){ 0x70, 0x79, 0x6E, 0x00 },
+    (uint8_t[4]){ 0x70, 0x6C, 0x79, 0x00 },
+    (uint8_t[5]){ 0x70, 0x61, 0x67, 0x65, 0x00 },
+    (uint8_t[4]){ 0x64, 0x79, 0x6E, 0x00 },
+    (uint8_t[4]){ 0x64, 0x61, 0x79, 0x00 },
+    (uint8_t[4]){ 0x64, 0x72, 0x79, 0x00 },
+    (uint8_t[4]){ 0x79, 0x70, 0x6E, 0x00 },
+    (uint8_t[4]){ 0x67, 0x79, 0x6E, 0x00 },
+    (uint8_t[9]){ 0x71, 0x75, 0x65, 0x73, 0x74, 0x69, 0x6F, 0x6E, 0x00 },
+    (uint8_t[8]){ 0x71, 0x75, 0x65, 0x73, 0x74, 0x65, 0x64, 0x00 },
+    (uint8_t[4]){ 0x75, 0x65, 0x6E, 0x00 },
+    (uint8_t[4]){ 0x65, 0x75, 0x6E, 0x00 },
+    (uint8_t[11]){ 0x32, 0x30, 0x32, 0x34, 0x2D, 0x30, 0x34, 0x2D, 0x83, 0x82, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x00 },
+    (uint8_t[11]){ 0xA6, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x6B, 0x65, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x00 },
+    (uint8_t[12]){ 0xA6, 0x6B, 0x65, 0x79, 0x5F, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x71, 0x61, 0x00 },
+    (uint8_t[15]){ 0x73, 0x69, 0x6D, 0x75, 0x6C, 0x74, 0x61, 0x6E, 0x65, 0x6F, 0x75, 0x73, 0x6C, 0x79, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x49, 0x80, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x49, 0x27, 0x6D, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x49, 0x27, 0x64, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x49, 0x27, 0x6C, 0x6C, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x49, 0x27, 0x76, 0x65, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x69, 0x73, 0x6E, 0x27, 0x74, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x69, 0x6E, 0x63, 0x72, 0x65, 0x61, 0x73, 0x65, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x73, 0x74, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x63, 0x6F, 0x6D, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x63, 0x72, 0x6F, 0x77, 0x64, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x63, 0x61, 0x6E, 0x27, 0x74, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x63, 0x6F, 0x75, 0x72, 0x73, 0x65, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x63, 0x61, 0x75, 0x73, 0x65, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x63, 0x6F, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x63, 0x61, 0x6C, 0x6C, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x72, 0x65, 0x61, 0x64, 0x79, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x72, 0x69, 0x76, 0x65, 0x72, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x72, 0x65, 0x61, 0x6C, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x72, 0x65, 0x6D, 0x65, 0x6D, 0x62, 0x65, 0x72, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x72, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x72, 0x65, 0x61, 0x63, 0x68, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x6C, 0x69, 0x6B, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x6C, 0x6F, 0x6F, 0x6B, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x6C, 0x69, 0x66, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x6C, 0x61, 0x73, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x6C, 0x69, 0x6E, 0x65, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x6C, 0x65, 0x61, 0x76, 0x65, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x6D, 0x61, 0x6B, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x6D, 0x69, 0x67, 0x68, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x6D, 0x6F, 0x73, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x6D, 0x6F, 0x72, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x6D, 0x75, 0x73, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x6D, 0x75, 0x63, 0x68, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x6D, 0x6F, 0x76, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x6D, 0x65, 0x61, 0x6E, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x6D, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x74, 0x68, 0x65, 0x72, 0x6D, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x74, 0x68, 0x72, 0x80, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x74, 0x68, 0x65, 0x72, 0x65, 0x80, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x74, 0x68, 0x65, 0x72, 0x65, 0x27, 0x73, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x74, 0x68, 0x69, 0x6E, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x74, 0x68, 0x65, 0x79, 0x27, 0x72, 0x65, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x74, 0x68, 0x65, 0x79, 0x27, 0x6C, 0x6C, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x74, 0x68, 0x69, 0x73, 0x80, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x74, 0x68, 0x65, 0x73, 0x65, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x74, 0x68, 0x61, 0x74, 0x27, 0x73, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x74, 0x68, 0x61, 0x6E, 0x80, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x74, 0x68, 0x61, 0x6E, 0x6B, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x74, 0x68, 0x6F, 0x73, 0x65, 0x80, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x74, 0x68, 0x6F, 0x75, 0x67, 0x68, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x74, 0x68, 0x6F, 0x75, 0x67, 0x68, 0x74, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x74, 0x68, 0x6F, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x74, 0x69, 0x6D, 0x65, 0x80, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x74, 0x68, 0x6F, 0x75, 0x67, 0x68, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x74, 0x68, 0x6F, 0x75, 0x67, 0x68, 0x74, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x74, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x74, 0x65, 0x63, 0x68, 0x6E, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x74, 0x61, 0x6B, 0x65, 0x00 },
+    (uint8_t[12]){ 0x6B, 0x6E, 0x6F, 0x77, 0x6C, 0x65, 0x64, 0x67, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[11]){ 0x6B, 0x6E, 0x6F, 0x77, 0x6C, 0x65, 0x64, 0x67, 0x65, 0x64, 0x00 },
+    (uint8_t[11]){ 0xA6, 0x6B, 0x6E, 0x6F, 0x77, 0x6C, 0x65, 0x64, 0x67, 0x65, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x6F, 0x78, 0x79, 0x67, 0x65, 0x6E, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x6F, 0x66, 0x74, 0x65, 0x6E, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x6F, 0x62, 0x73, 0x65, 0x72, 0x76, 0x65, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x6F, 0x70, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x65, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 0x61, 0x6C, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x6F, 0x63, 0x63, 0x75, 0x72, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x6F, 0x66, 0x66, 0x65, 0x72, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x62, 0x6F, 0x74, 0x68, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x62, 0x65, 0x63, 0x61, 0x75, 0x73, 0x65, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x62, 0x65, 0x63, 0x6F, 0x6D, 0x65, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x62, 0x61, 0x63, 0x6B, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x62, 0x65, 0x67, 0x69, 0x6E, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x62, 0x65, 0x6C, 0x69, 0x65, 0x76, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x62, 0x65, 0x65, 0x6E, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x62, 0x72, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x66, 0x72, 0x69, 0x65, 0x6E, 0x64, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x66, 0x69, 0x6E, 0x64, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x66, 0x65, 0x65, 0x6C, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x66, 0x61, 0x63, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x66, 0x61, 0x63, 0x74, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x6E, 0x65, 0x76, 0x65, 0x72, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x6E, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x6E, 0x65, 0x65, 0x64, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x6E, 0x6F, 0x77, 0x68, 0x65, 0x72, 0x65, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x6E, 0x6F, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x6E, 0x65, 0x69, 0x67, 0x68, 0x62, 0x6F, 0x72, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x65, 0x6E, 0x6F, 0x75, 0x67, 0x68, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x65, 0x76, 0x65, 0x6E, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x65, 0x76, 0x65, 0x72, 0x79, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x65, 0x61, 0x72, 0x6C, 0x79, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x65, 0x78, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x65, 0x78, 0x65, 0x72, 0x63, 0x69, 0x73, 0x65, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x65, 0x78, 0x70, 0x65, 0x72, 0x74, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x65, 0x71, 0x75, 0x61, 0x6C, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x77, 0x68, 0x69, 0x63, 0x68, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x77, 0x68, 0x65, 0x6E, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x77, 0x68, 0x65, 0x72, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x77, 0x68, 0x61, 0x74, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x77, 0x6F, 0x6E, 0x27, 0x74, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x77, 0x6F, 0x72, 0x6C, 0x64, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x77, 0x6F, 0x72, 0x6B, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x77, 0x65, 0x27, 0x72, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x77, 0x65, 0x27, 0x64, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x77, 0x65, 0x27, 0x6C, 0x6C, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x77, 0x65, 0x27, 0x76, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x77, 0x61, 0x79, 0x6E, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x77, 0x69, 0x6C, 0x6C, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x77, 0x65, 0x6C, 0x6C, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x77, 0x72, 0x69, 0x74, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x77, 0x6F, 0x72, 0x64, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x77, 0x69, 0x74, 0x68, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x76, 0x69, 0x65, 0x77, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x76, 0x69, 0x65, 0x77, 0x65, 0x72, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x76, 0x69, 0x65, 0x77, 0x65, 0x64, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x76, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x61, 0x62, 0x6F, 0x76, 0x65, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x61, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x61, 0x6C, 0x73, 0x6F, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x61, 0x66, 0x74, 0x65, 0x72, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x61, 0x6E, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x61, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x61, 0x67, 0x61, 0x69, 0x6E, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x61, 0x67, 0x61, 0x69, 0x6E, 0x73, 0x74, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x61, 0x6E, 0x73, 0x77, 0x65, 0x72, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x61, 0x6C, 0x72, 0x65, 0x61, 0x64, 0x79, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x61, 0x6C, 0x72, 0x69, 0x67, 0x68, 0x74, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x73, 0x6F, 0x6D, 0x65, 0x80, 0x00 },
+    (uint8_t[11]){ 0xA6, 0x73, 0x6F, 0x6D, 0x65, 0x74, 0x69, 0x6D, 0x65, 0x73, 0x00 },
+    (uint8_t[11]){ 0xA6, 0x73, 0x6F, 0x6D, 0x65, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x73, 0x6F, 0x6D, 0x65, 0x68, 0x6F, 0x77, 0x00 },
+    (uint8_t[11]){ 0xA6, 0x73, 0x6F, 0x6D, 0x65, 0x77, 0x68, 0x65, 0x72, 0x65, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x73, 0x6F, 0x6D, 0x65, 0x6F, 0x6E, 0x65, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x73, 0x6F, 0x75, 0x6E, 0x64, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x73, 0x63, 0x69, 0x65, 0x6E, 0x63, 0x65, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6C, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x73, 0x74, 0x61, 0x74, 0x65, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x73, 0x68, 0x65, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x73, 0x69, 0x6E, 0x63, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x73, 0x75, 0x63, 0x68, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x73, 0x63, 0x68, 0x6F, 0x6F, 0x6C, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x70, 0x72, 0x6F, 0x62, 0x6C, 0x65, 0x6D, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x70, 0x65, 0x6F, 0x70, 0x6C, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x70, 0x6C, 0x61, 0x79, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x70, 0x6F, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x65, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x70, 0x65, 0x72, 0x73, 0x6F, 0x6E, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x70, 0x6F, 0x77, 0x65, 0x72, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x70, 0x75, 0x62, 0x6C, 0x69, 0x63, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x70, 0x73, 0x79, 0x63, 0x68, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x70, 0x79, 0x6E, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x70, 0x72, 0x6F, 0x62, 0x61, 0x62, 0x6C, 0x65, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x64, 0x6F, 0x6E, 0x27, 0x74, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x64, 0x69, 0x64, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x64, 0x6F, 0x65, 0x73, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x00 },
+    (uint8_t[11]){ 0xA6, 0x64, 0x69, 0x66, 0x66, 0x69, 0x63, 0x75, 0x6C, 0x74, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x64, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x64, 0x6F, 0x77, 0x6E, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x64, 0x65, 0x63, 0x69, 0x64, 0x65, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x75, 0x73, 0x65, 0x66, 0x75, 0x6C, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x75, 0x73, 0x65, 0x72, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x75, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x68, 0x61, 0x76, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[4]){ 0xA6, 0x68, 0x65, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x68, 0x65, 0x72, 0x65, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x68, 0x6F, 0x75, 0x73, 0x65, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x68, 0x61, 0x76, 0x65, 0x6E, 0x27, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x68, 0x65, 0x6C, 0x70, 0x00 },
+    (uint8_t[5]){ 0xA6, 0x68, 0x61, 0x64, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x67, 0x69, 0x76, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x67, 0x6F, 0x76, 0x65, 0x72, 0x6E, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x67, 0x72, 0x65, 0x61, 0x74, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x67, 0x6F, 0x6F, 0x64, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x67, 0x75, 0x61, 0x67, 0x65, 0x00 },
+    (uint8_t[11]){ 0xA6, 0x67, 0x75, 0x61, 0x72, 0x61, 0x6E, 0x74, 0x65, 0x65, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x79, 0x6F, 0x75, 0x27, 0x72, 0x65, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x79, 0x6F, 0x75, 0x27, 0x6C, 0x6C, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x79, 0x6F, 0x75, 0x27, 0x76, 0x65, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x79, 0x6F, 0x75, 0x27, 0x64, 0x00 },
+    (uint8_t[11]){ 0xA6, 0x79, 0x65, 0x73, 0x74, 0x65, 0x72, 0x64, 0x61, 0x79, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x79, 0x65, 0x6C, 0x6C, 0x6F, 0x77, 0x00 },
+    (uint8_t[7]){ 0x6D, 0x61, 0x6B, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[6]){ 0x74, 0x61, 0x6B, 0x65, 0x6E, 0x00 },
+    (uint8_t[7]){ 0x74, 0x61, 0x6B, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[6]){ 0x6C, 0x6C, 0x69, 0x6F, 0x6E, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x6A, 0x75, 0x64, 0x67, 0x65, 0x00 },
+    (uint8_t[20]){ 0xA6, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x5F, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x00 },
+    (uint8_t[20]){ 0xA6, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x2D, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x71, 0x75, 0x61, 0x6C, 0x69, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x71, 0x75, 0x61, 0x6C, 0x69, 0x74, 0x79, 0x00 },
+    (uint8_t[13]){ 0x73, 0x69, 0x6D, 0x75, 0x6C, 0x74, 0x61, 0x6E, 0x65, 0x6F, 0x75, 0x73, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x69, 0x74, 0x27, 0x73, 0x00 },
+    (uint8_t[12]){ 0xA6, 0x69, 0x6E, 0x63, 0x72, 0x65, 0x61, 0x73, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[11]){ 0xA6, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[13]){ 0xA6, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x73, 0x74, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[12]){ 0xA6, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x73, 0x74, 0x65, 0x64, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[13]){ 0xA6, 0x63, 0x6F, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[12]){ 0xA6, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x65, 0x72, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x6E, 0x27, 0x74, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x6E, 0x27, 0x74, 0x00 },
+    (uint8_t[11]){ 0xA6, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x6E, 0x27, 0x74, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x27, 0x76, 0x65, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x27, 0x76, 0x65, 0x00 },
+    (uint8_t[11]){ 0xA6, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x27, 0x76, 0x65, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x72, 0x65, 0x61, 0x6C, 0x6C, 0x79, 0x00 },
+    (uint8_t[12]){ 0xA6, 0x72, 0x65, 0x73, 0x74, 0x61, 0x75, 0x72, 0x61, 0x6E, 0x74, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x6C, 0x6F, 0x6F, 0x6B, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[12]){ 0xA6, 0x74, 0x65, 0x63, 0x68, 0x6E, 0x6F, 0x6C, 0x6F, 0x67, 0x79, 0x00 },
+    (uint8_t[11]){ 0xA6, 0x74, 0x65, 0x63, 0x68, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x00 },
+    (uint8_t[11]){ 0xA6, 0x74, 0x65, 0x63, 0x68, 0x6E, 0x69, 0x71, 0x75, 0x65, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x74, 0x61, 0x6B, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[13]){ 0xA6, 0x6B, 0x6E, 0x6F, 0x77, 0x6C, 0x65, 0x64, 0x67, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[12]){ 0xA6, 0x6B, 0x6E, 0x6F, 0x77, 0x6C, 0x65, 0x64, 0x67, 0x65, 0x64, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[11]){ 0xA6, 0x62, 0x61, 0x63, 0x6B, 0x73, 0x70, 0x61, 0x63, 0x65, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x65, 0x64, 0x00 },
+    (uint8_t[11]){ 0xA6, 0x65, 0x76, 0x65, 0x72, 0x79, 0x74, 0x69, 0x6D, 0x65, 0x00 },
+    (uint8_t[12]){ 0xA6, 0x65, 0x76, 0x65, 0x72, 0x79, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x65, 0x71, 0x75, 0x61, 0x74, 0x65, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x77, 0x68, 0x61, 0x74, 0x27, 0x73, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x77, 0x65, 0x72, 0x65, 0x6E, 0x27, 0x74, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x77, 0x72, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x00 },
+    (uint8_t[11]){ 0xA6, 0x77, 0x6F, 0x72, 0x64, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x61, 0x72, 0x65, 0x6E, 0x27, 0x74, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x73, 0x68, 0x65, 0x27, 0x73, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x73, 0x68, 0x65, 0x27, 0x64, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x73, 0x68, 0x65, 0x27, 0x6C, 0x6C, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x70, 0x72, 0x6F, 0x62, 0x61, 0x62, 0x6C, 0x79, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x64, 0x69, 0x64, 0x6E, 0x27, 0x74, 0x00 },
+    (uint8_t[9]){ 0xA6, 0x64, 0x6F, 0x65, 0x73, 0x6E, 0x27, 0x74, 0x00 },
+    (uint8_t[11]){ 0xA6, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x74, 0x00 },
+    (uint8_t[13]){ 0xA6, 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x6D, 0x65, 0x6E, 0x74, 0x00 },
+    (uint8_t[11]){ 0xA6, 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x65, 0x64, 0x00 },
+    (uint8_t[11]){ 0xA6, 0x64, 0x65, 0x76, 0x65, 0x6C, 0x6F, 0x70, 0x65, 0x72, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x68, 0x65, 0x27, 0x73, 0x00 },
+    (uint8_t[7]){ 0xA6, 0x68, 0x65, 0x27, 0x6C, 0x6C, 0x00 },
+    (uint8_t[6]){ 0xA6, 0x68, 0x65, 0x27, 0x64, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x68, 0x61, 0x73, 0x6E, 0x27, 0x74, 0x00 },
+    (uint8_t[8]){ 0xA6, 0x68, 0x61, 0x64, 0x6E, 0x27, 0x74, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x67, 0x6F, 0x76, 0x65, 0x72, 0x6E, 0x65, 0x64, 0x00 },
+    (uint8_t[12]){ 0xA6, 0x67, 0x6F, 0x76, 0x65, 0x72, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x00 },
+    (uint8_t[7]){ 0x76, 0x69, 0x6C, 0x69, 0x6F, 0x6E, 0x00 },
+    (uint8_t[10]){ 0xA6, 0x6A, 0x75, 0x64, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x00 },
+    (uint8_t[9]){ 0x6A, 0x75, 0x64, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x00 },
+    (uint8_t[13]){ 0xA6, 0x74, 0x65, 0x63, 0x68, 0x6E, 0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x00 },
+    (uint8_t[8]){ 0x62, 0x6C, 0x69, 0x76, 0x69, 0x6F, 0x6E, 0x00 },
+    (uint8_t[12]){ 0xA6, 0x6A, 0x75, 0x64, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x6C, 0x00 },
+    (uint8_t[21]){ 0xA6, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x80, 0x00 },
+    0
+};
\ No newline at end of file
@@ -0,0 +1,192 @@
+// Copyright 2024 Guillaume Stordeur <guillaume.stordeur@gmail.com>
+// Copyright 2024 Matt Skalecki <ikcelaks@gmail.com>
+// Copyright 2024 QKekos <q.kekos.q@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+
+#include "st_defaults.h"
+#include "qmk_wrapper.h"
+#include "keybuffer.h"
+#include "predicates.h"
+#include "triecodes.h"
+#include "sequence_transform_data.h"
+#include "snapshot.h"
+
+#if SEQUENCE_TRANSFORM_HOST_SIMD
+
+#include <string.h>
+
+//////////////////////////////////////////////////////////////////
+// The same code is built for 32 byte (AVX2) or 16 byte (SSE2) vectors,
+// and falls back to a loop over the keys for other targets
+#if defined(__AVX2__)
+#   include <immintrin.h>
+#   define VEC_SIZE             32
+typedef __m256i st_vec_t;
+typedef uint32_t st_vec_mask_t;
+#   define VEC_LOAD(p)          _mm256_loadu_si256((const __m256i *)(p))
+#   define VEC_STORE(p, v)      _mm256_storeu_si256((__m256i *)(p), v)
+#   define VEC_SET(c)           _mm256_set1_epi8((char)(c))
+#   define VEC_EQ(a, b)         _mm256_cmpeq_epi8(a, b)
+#   define VEC_GT(a, b)         _mm256_cmpgt_epi8(a, b)
+#   define VEC_MAXU(a, b)       _mm256_max_epu8(a, b)
+#   define VEC_AND(a, b)        _mm256_and_si256(a, b)
+#   define VEC_ANDNOT(a, b)     _mm256_andnot_si256(a, b)
+#   define VEC_OR(a, b)         _mm256_or_si256(a, b)
+#   define VEC_MASK(v)          ((st_vec_mask_t)_mm256_movemask_epi8(v))
+#elif defined(__SSE2__)
+#   include <emmintrin.h>
+#   define VEC_SIZE             16
+typedef __m128i st_vec_t;
+typedef uint16_t st_vec_mask_t;
+#   define VEC_LOAD(p)          _mm_loadu_si128((const __m128i *)(p))
+#   define VEC_STORE(p, v)      _mm_storeu_si128((__m128i *)(p), v)
+#   define VEC_SET(c)           _mm_set1_epi8((char)(c))
+#   define VEC_EQ(a, b)         _mm_cmpeq_epi8(a, b)
+#   define VEC_GT(a, b)         _mm_cmpgt_epi8(a, b)
+#   define VEC_MAXU(a, b)       _mm_max_epu8(a, b)
+#   define VEC_AND(a, b)        _mm_and_si128(a, b)
+#   define VEC_ANDNOT(a, b)     _mm_andnot_si128(a, b)
+#   define VEC_OR(a, b)         _mm_or_si128(a, b)
+#   define VEC_MASK(v)          ((st_vec_mask_t)_mm_movemask_epi8(v))
+#endif
+
+#ifdef VEC_SIZE
+//////////////////////////////////////////////////////////////////
+// Signed compares, so triecodes >= 0x80 are never in range
+static inline st_vec_t vec_in_range(st_vec_t v, char lo, char hi)
+{
+    return VEC_AND(VEC_GT(v, VEC_SET(lo - 1)), VEC_GT(VEC_SET(hi + 1), v));
+}
+//////////////////////////////////////////////////////////////////
+// Sets bit n of each byte if st_predicates[n] matches the triecode
+static inline st_vec_t vec_classify(st_vec_t v)
+{
+    const st_vec_t upper = vec_in_range(v, 'A', 'Z');
+    const st_vec_t alpha = VEC_OR(upper, vec_in_range(v, 'a', 'z'));
+    const st_vec_t digit = vec_in_range(v, '0', '9');
+    const st_vec_t terminating = VEC_OR(VEC_OR(VEC_EQ(v, VEC_SET('.')), VEC_EQ(v, VEC_SET('!'))),
+                                        VEC_EQ(v, VEC_SET('?')));
+    const st_vec_t connecting = VEC_OR(VEC_OR(VEC_EQ(v, VEC_SET(',')), VEC_EQ(v, VEC_SET(';'))),
+                                       VEC_EQ(v, VEC_SET(':')));
+    const st_vec_t ascii = VEC_GT(v, VEC_SET(-1));
+    st_vec_t classes = VEC_SET(0x80);   // st_pred_any
+    classes = VEC_OR(classes, VEC_AND(upper, VEC_SET(0x01)));
+    classes = VEC_OR(classes, VEC_AND(alpha, VEC_SET(0x02)));
+    classes = VEC_OR(classes, VEC_AND(digit, VEC_SET(0x04)));
+    classes = VEC_OR(classes, VEC_AND(terminating, VEC_SET(0x08)));
+    classes = VEC_OR(classes, VEC_AND(connecting, VEC_SET(0x10)));
+    classes = VEC_OR(classes, VEC_AND(VEC_OR(terminating, connecting), VEC_SET(0x20)));
+    classes = VEC_OR(classes, VEC_AND(VEC_ANDNOT(alpha, ascii), VEC_SET(0x40)));
+    return classes;
+}
+#endif
+
+//////////////////////////////////////////////////////////////////
+// Copies the `count` most recent keys of the buffer (as many as
+// a sequence can read), and classifies them against every predicate
+void st_snapshot_take(st_snapshot_t *snap, const st_key_buffer_t *buf, int count)
+{
+    snap->size = MIN(MIN(buf->size, count), ST_SNAPSHOT_CAPACITY);
+    for (int i = 0; i < snap->size; ++i) {
+        snap->triecodes[i] = st_key_buffer_get(buf, i)->triecode;
+    }
+    memset(snap->triecodes + snap->size, 0, ST_SNAPSHOT_PADDING);
+#ifdef VEC_SIZE
+    for (int i = 0; i < snap->size; i += VEC_SIZE) {
+        VEC_STORE(snap->classes + i, vec_classify(VEC_LOAD(snap->triecodes + i)));
+    }
+#else
+    for (int i = 0; i < snap->size; ++i) {
+        snap->classes[i] = 0;
+        for (int pred = 0; pred < ST_PREDICATE_COUNT; ++pred) {
+            if (st_predicate_test_triecode(pred, snap->triecodes[i])) {
+                snap->classes[i] |= 1 << pred;
+            }
+        }
+    }
+#endif
+    // no predicate matches past the last key
+    memset(snap->classes + snap->size, 0, ST_SNAPSHOT_PADDING);
+}
+//////////////////////////////////////////////////////////////////
+// vec_classify duplicates predicates.c, so this checks the classes it
+// gives every triecode against st_predicate_test_triecode.
+// Returns the first triecode they disagree on, or -1.
+int st_snapshot_check_classes(void)
+{
+#ifdef VEC_SIZE
+    uint8_t triecodes[256];
+    uint8_t classes[256];
+    for (int i = 0; i < 256; ++i) {
+        triecodes[i] = i;
+    }
+    for (int i = 0; i < 256; i += VEC_SIZE) {
+        VEC_STORE(classes + i, vec_classify(VEC_LOAD(triecodes + i)));
+    }
+    for (int i = 0; i < 256; ++i) {
+        for (int pred = 0; pred < ST_PREDICATE_COUNT; ++pred) {
+            if (((classes[i] >> pred) & 1) != st_predicate_test_triecode(pred, i)) {
+                return i;
+            }
+        }
+    }
+#endif
+    return -1;
+}
+//////////////////////////////////////////////////////////////////
+// Compares the zero terminated chain of triecodes with the snapshot
+// keys starting at `index`. `chain_size` is the number of bytes that
+// can be read from `chain`.
+// Returns the number of leading triecodes that match, so chain[result]
+// is 0 if the whole chain matched. Stops at the end of the snapshot,
+// which may be before the end of the key buffer.
+int st_snapshot_match_chain(const st_snapshot_t *snap, int index, const uint8_t *chain, int chain_size)
+{
+    int count = 0;
+#ifdef VEC_SIZE
+    for (; index + count < snap->size; count += VEC_SIZE) {
+        uint8_t tail[VEC_SIZE];
+        const uint8_t *codes = chain + count;
+        if (chain_size - count < VEC_SIZE) {
+            // don't read past the end of the trie data
+            memset(tail, 0, VEC_SIZE);
+            memcpy(tail, codes, chain_size - count);
+            codes = tail;
+        }
+        const st_vec_t code = VEC_LOAD(codes);
+        const st_vec_t key = VEC_LOAD(snap->triecodes + index + count);
+        const st_vec_t classes = VEC_LOAD(snap->classes + index + count);
+        // Metachar codes match if their predicate's class bit is set,
+        // other codes must equal the key
+        const st_vec_t is_metachar = VEC_EQ(VEC_MAXU(code, VEC_SET(TRIECODE_SEQUENCE_METACHAR_0)), code);
+        st_vec_t pred_bit = VEC_SET(0);
+        for (int pred = 0; pred < ST_PREDICATE_COUNT; ++pred) {
+            const st_vec_t is_pred = VEC_EQ(code, VEC_SET(TRIECODE_SEQUENCE_METACHAR_0 + pred));
+            pred_bit = VEC_OR(pred_bit, VEC_AND(is_pred, VEC_SET(1 << pred)));
+        }
+        const st_vec_t class_match = VEC_ANDNOT(VEC_EQ(VEC_AND(classes, pred_bit), VEC_SET(0)), is_metachar);
+        const st_vec_t match = VEC_OR(class_match, VEC_ANDNOT(is_metachar, VEC_EQ(code, key)));
+        const st_vec_mask_t stop = (st_vec_mask_t)~VEC_MASK(match) | VEC_MASK(VEC_EQ(code, VEC_SET(0)));
+        if (stop) {
+            return count + __builtin_ctz(stop);
+        }
+    }
+#else
+    for (; index + count < snap->size && count < chain_size; ++count) {
+        const uint8_t code = chain[count];
+        if (!code) {
+            break;
+        }
+        const bool match = code >= TRIECODE_SEQUENCE_METACHAR_0
+            ? code - TRIECODE_SEQUENCE_METACHAR_0 < ST_PREDICATE_COUNT
+                && (snap->classes[index + count] & (1 << (code - TRIECODE_SEQUENCE_METACHAR_0)))
+            : code == snap->triecodes[index + count];
+        if (!match) {
+            break;
+        }
+    }
+#endif
+    return count;
+}
+
+#endif
@@ -0,0 +1,26 @@
+// Copyright 2024 Guillaume Stordeur <guillaume.stordeur@gmail.com>
+// Copyright 2024 Matt Skalecki <ikcelaks@gmail.com>
+// Copyright 2024 QKekos <q.kekos.q@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+//////////////////////////////////////////////////////////////////
+// Public API
+
+#if SEQUENCE_TRANSFORM_HOST_SIMD
+
+#define ST_SNAPSHOT_CAPACITY    64      // most recent keys copied
+#define ST_SNAPSHOT_PADDING     32      // widest vector compare reads past the last key
+
+typedef struct
+{
+    int     size;       // number of keys copied (-1 if not taken yet)
+    uint8_t triecodes[ST_SNAPSHOT_CAPACITY + ST_SNAPSHOT_PADDING];  // most recent first, zero padded
+    uint8_t classes[ST_SNAPSHOT_CAPACITY + ST_SNAPSHOT_PADDING];    // bit n set if predicate n matches
+} st_snapshot_t;
+
+void    st_snapshot_take(st_snapshot_t *snap, const st_key_buffer_t *buf, int count);
+int     st_snapshot_match_chain(const st_snapshot_t *snap, int index, const uint8_t *chain, int chain_size);
+int     st_snapshot_check_classes(void);
+
+#endif
@@ -5,12 +5,11 @@
 
 #include <stdbool.h>
 #include <string.h>
+#include "qmk_wrapper.h"
 #include "st_debug.h"
 
 static long st_debug_bits = 0;
 
-#define FLAG_BIT(flag) (1 << (flag - 1))
-
 //////////////////////////////////////////////////////////////////////
 static const char *st_debug_flag_names[] = {
     [ST_DBG_GENERAL]        = "general",
@@ -46,7 +45,7 @@ void st_debug_set_flag_str(const char *flag)
 //////////////////////////////////////////////////////////////////////
 void st_debug_set_flag(st_debug_flag_t flag)
 {
-    st_debug_bits |= FLAG_BIT(flag);
+    st_debug_bits |= ST_DBG_BIT(flag);
 }
 //////////////////////////////////////////////////////////////////////
 void st_debug_set_all_flags(void)
@@ -61,5 +60,26 @@ void st_debug_clear_all_flags(void)
 //////////////////////////////////////////////////////////////////////
 bool st_debug_test_flag(st_debug_flag_t flag)
 {
-    return (st_debug_bits & FLAG_BIT(flag)) ? true : false;
+    return (st_debug_bits & ST_DBG_BIT(flag)) ? true : false;
+}
+#if SEQUENCE_TRANSFORM_TRACE
+st_trace_t st_trace = {{{0}}, 0};
+//////////////////////////////////////////////////////////////////////
+// Prints the last `count` records, oldest first, as
+// event offset index sub_index triecode value
+void st_trace_dump(int count)
+{
+    const uint32_t total = st_trace.count;
+    if (count > SEQUENCE_TRANSFORM_TRACE_SIZE) {
+        count = SEQUENCE_TRANSFORM_TRACE_SIZE;
+    }
+    if ((uint32_t)count > total) {
+        count = total;
+    }
+    for (uint32_t i = total - count; i < total; ++i) {
+        const st_trace_record_t *r = &st_trace.records[i % SEQUENCE_TRANSFORM_TRACE_SIZE];
+        uprintf("st_trace %u %u %u %u %#04X %#06X\n", r->event, r->offset, r->index, r->sub_index,
+            r->triecode, r->value);
+    }
 }
+#endif
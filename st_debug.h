@@ -38,4 +38,65 @@ const char  **st_debug_get_flag_names(void);
     (SEQUENCE_TRANSFORM_DEBUG && \
      st_debug_test_flag(flag))
 
+#define ST_DBG_BIT(flag) (1 << ((flag) - 1))
+
+//////////////////////////////////////////////////////////////////
+// Binary trace of the hot paths, where formatting debug prints would
+// cost more than the search itself. Records are decoded by the tester.
+
+typedef enum
+{
+    ST_TRACE_NODE = 1,      // value: node bits (see st_find_longest_chain)
+    ST_TRACE_BRANCH,        // value: entry code compared with the key
+    ST_TRACE_MULTI_BRANCH,  // value: entry code, +0x100 if it matched the key
+    ST_TRACE_CHAIN,         // value: chain code compared with the key
+    ST_TRACE_CHAIN_SNAPSHOT,// value: chain codes that matched the snapshot
+    ST_TRACE_MATCH,         // value: segment length of the new longest match
+    ST_TRACE_CHAINED_CHECK, // value: match index of the key's rule
+    ST_TRACE_SUB_RULE,      // value: sub-rule match index compared with it
+    ST_TRACE_PRUNE,         // value: min depth of the node
+    ST_TRACE_PREDICATE,     // value: predicate index, +0x100 if it matched
+} st_trace_event_t;
+
+typedef struct
+{
+    uint8_t     event;      // st_trace_event_t
+    uint8_t     triecode;   // key the event is about
+    uint16_t    offset;     // trie data offset
+    uint8_t     index;      // cursor position
+    uint8_t     sub_index;
+    uint16_t    value;      // depends on event
+} st_trace_record_t;
+
+typedef struct
+{
+    st_trace_record_t   records[SEQUENCE_TRANSFORM_TRACE_SIZE];
+    uint32_t            count;  // records written since startup
+} st_trace_t;
+
+extern st_trace_t st_trace;
+
+void    st_trace_dump(int count);
+
+static inline void st_trace_record(uint8_t event, uint16_t offset, uint8_t index, uint8_t sub_index,
+                                   uint8_t triecode, uint16_t value)
+{
+    st_trace_record_t *record = &st_trace.records[st_trace.count++ % SEQUENCE_TRANSFORM_TRACE_SIZE];
+    record->event = event;
+    record->triecode = triecode;
+    record->offset = offset;
+    record->index = index;
+    record->sub_index = sub_index;
+    record->value = value;
+}
+
+// Like st_debug, always checked by the compiler, but only
+// flags set in SEQUENCE_TRANSFORM_TRACE generate code
+#define st_trace(flag, event, offset, index, sub_index, triecode, value)                   \
+    do {                                                                                    \
+        if (SEQUENCE_TRANSFORM_TRACE & ST_DBG_BIT(flag)) {                                  \
+            st_trace_record(event, offset, index, sub_index, triecode, value);              \
+        }                                                                                   \
+    } while (0)
+
 
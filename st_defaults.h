@@ -15,6 +15,31 @@
 #define SEQUENCE_TRANSFORM_ENHANCED_BACKSPACE 1
 #endif
 
+// Number of rule actions enhanced backspace can undo by resending the
+// chars they deleted, instead of working out the output from the trie
+// again (which resets the buffer when the keys are no longer in it).
+// Off by default: it costs MAX_BACKSPACES + 5 bytes of RAM per entry,
+// plus MAX_BACKSPACES + 1 bytes of recently sent chars.
+#ifndef SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE
+#define SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE 0
+#endif
+
+// Time in ms between the backspaces sent while backspace is held past
+// TAPPING_TERM, each undoing one key like a tap does. Needs
+// sequence_transform_task() to be called from matrix_scan_user.
+// With 0, the host repeats the held backspace instead, and since the
+// keyboard can't tell how many chars that deleted, the buffer is reset.
+#ifndef SEQUENCE_TRANSFORM_BACKSPACE_REPEAT
+#define SEQUENCE_TRANSFORM_BACKSPACE_REPEAT 0
+#endif
+
+#if !SEQUENCE_TRANSFORM_ENHANCED_BACKSPACE
+#undef  SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE
+#define SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE 0
+#undef  SEQUENCE_TRANSFORM_BACKSPACE_REPEAT
+#define SEQUENCE_TRANSFORM_BACKSPACE_REPEAT 0
+#endif
+
 #ifndef SEQUENCE_TRANSFORM_FALLBACK_BUFFER
 #define SEQUENCE_TRANSFORM_FALLBACK_BUFFER 1
 #endif
@@ -23,10 +48,28 @@
 #define SEQUENCE_TRANSFORM_DEBUG 0
 #endif
 
+// Record trie search events in a RAM ring buffer of TRACE_SIZE entries
+// (a power of 2, 8 bytes each) for the debug flags set in this mask:
+// 0x01 general, 0x02 sequence_match, 0x04 rule_search, 0x08 cursor,
+// 0x10 backspace. Events of other flags generate no code.
+#ifndef SEQUENCE_TRANSFORM_TRACE
+#define SEQUENCE_TRANSFORM_TRACE 0
+#endif
+
+#ifndef SEQUENCE_TRANSFORM_TRACE_SIZE
+#define SEQUENCE_TRANSFORM_TRACE_SIZE 64
+#endif
+
 #ifndef SEQUENCE_TRANSFORM_LOG_TIME
 #define SEQUENCE_TRANSFORM_LOG_TIME 0
 #endif
 
+// Keep histograms of how long st_perform, backspace and rule searches
+// take in RAM (about 320 bytes), printed by sequence_transform_dump_latency()
+#ifndef SEQUENCE_TRANSFORM_LATENCY_HISTOGRAMS
+#define SEQUENCE_TRANSFORM_LATENCY_HISTOGRAMS 0
+#endif
+
 #ifndef SEQUENCE_TRANSFORM_RULE_SEARCH
 #define SEQUENCE_TRANSFORM_RULE_SEARCH 0
 #endif
@@ -43,6 +86,59 @@
 #define SEQUENCE_TRANSFORM_EXTRA_BUFFER 10
 #endif
 
+#ifndef SEQUENCE_TRANSFORM_TRIGGER_FILTER
+#define SEQUENCE_TRANSFORM_TRIGGER_FILTER 1
+#endif
+
+#ifndef SEQUENCE_TRANSFORM_TRIGGER_PAIR_FILTER
+#define SEQUENCE_TRANSFORM_TRIGGER_PAIR_FILTER 0
+#endif
+
+// Store trie words little-endian at even offsets, so they can be read
+// with a single load. Faster on 32bit targets, at the cost of some flash.
+#ifndef SEQUENCE_TRANSFORM_TRIE_ALIGNED
+#define SEQUENCE_TRANSFORM_TRIE_ALIGNED 0
+#endif
+
+// Store completions canonical Huffman coded. Saves flash
+// at the cost of decoding them whenever they are read.
+#ifndef SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS
+#define SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS 0
+#endif
+
+// Number of failed searches to remember (power of 2, SEQUENCE_MAX_LENGTH + 5 bytes
+// of RAM each, plus 8 bytes per key buffer entry for running totals)
+#ifndef SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE
+#define SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE 0
+#endif
+
+// Read the trie and completions from a block device (EEPROM, SPI flash)
+// through a RAM cache of PAGE_COUNT pages of PAGE_SIZE bytes (a power of 2)
+// instead of directly from PROGMEM. 0 disables the page cache.
+// The first PINNED_PAGES pages hold the top level trie nodes and are never evicted.
+#ifndef SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE
+#define SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE 0
+#endif
+
+#ifndef SEQUENCE_TRANSFORM_STORAGE_PAGE_COUNT
+#define SEQUENCE_TRANSFORM_STORAGE_PAGE_COUNT 8
+#endif
+
+#ifndef SEQUENCE_TRANSFORM_STORAGE_PINNED_PAGES
+#define SEQUENCE_TRANSFORM_STORAGE_PINNED_PAGES 2
+#endif
+
+// Host builds only (tester, host library): compare chain nodes against
+// a snapshot of the key buffer with SSE2/AVX2 when the compiler targets them
+#ifndef SEQUENCE_TRANSFORM_HOST_SIMD
+#define SEQUENCE_TRANSFORM_HOST_SIMD 0
+#endif
+
+#if !defined(ST_HOST) && !defined(ST_TESTER)
+#undef  SEQUENCE_TRANSFORM_HOST_SIMD
+#define SEQUENCE_TRANSFORM_HOST_SIMD 0
+#endif
+
 // Disable features that do nothing without print
 #ifdef NO_PRINT
 #undef  SEQUENCE_TRANSFORM_DEBUG
@@ -51,6 +147,9 @@
 #undef  SEQUENCE_TRANSFORM_LOG_TIME
 #define SEQUENCE_TRANSFORM_LOG_TIME 0
 
+#undef  SEQUENCE_TRANSFORM_LATENCY_HISTOGRAMS
+#define SEQUENCE_TRANSFORM_LATENCY_HISTOGRAMS 0
+
 #undef  SEQUENCE_TRANSFORM_RECORD_RULE_USAGE
 #define SEQUENCE_TRANSFORM_RECORD_RULE_USAGE 0
 #endif
@@ -0,0 +1,129 @@
+// Copyright 2024 Guillaume Stordeur <guillaume.stordeur@gmail.com>
+// Copyright 2024 Matt Skalecki <ikcelaks@gmail.com>
+// Copyright 2024 QKekos <q.kekos.q@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+
+#include "st_defaults.h"
+#include "qmk_wrapper.h"
+#include "st_assert.h"
+#include "storage.h"
+
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE & (SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE - 1)
+#   error "SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE must be a power of 2"
+#endif
+#if SEQUENCE_TRANSFORM_STORAGE_PINNED_PAGES >= SEQUENCE_TRANSFORM_STORAGE_PAGE_COUNT
+#   error "SEQUENCE_TRANSFORM_STORAGE_PINNED_PAGES must leave pages for the cache"
+#endif
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_COUNT > 255
+#   error "SEQUENCE_TRANSFORM_STORAGE_PAGE_COUNT must be less than 256"
+#endif
+
+#define PAGE_MASK ((uint32_t)SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE - 1)
+
+//////////////////////////////////////////////////////////////////
+void st_storage_init(st_storage_t *storage, st_storage_read_fn_t read, void *context)
+{
+    storage->read = read;
+    storage->context = context;
+    storage->pinned_count = 0;
+    st_storage_reset(storage);
+}
+//////////////////////////////////////////////////////////////////
+// Empties the cache (including pinned pages)
+void st_storage_reset(st_storage_t *storage)
+{
+    for (int i = 0; i < SEQUENCE_TRANSFORM_STORAGE_PAGE_COUNT; ++i) {
+        storage->tags[i] = 0;
+        storage->last_used[i] = 0;
+    }
+    storage->clock = 0;
+    storage->recent = 0;
+    storage->pinned_count = 0;
+#ifdef ST_TESTER
+    storage->reads = 0;
+    storage->misses = 0;
+#endif
+}
+//////////////////////////////////////////////////////////////////
+// Fills page slot i with the page at address (page aligned).
+// A page that fails to read is returned zeroed, but not kept.
+static void load_page(st_storage_t *storage, int i, uint32_t address)
+{
+    if (storage->read(storage->context, address, storage->pages[i], SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE)) {
+        storage->tags[i] = address + 1;
+    } else {
+        memset(storage->pages[i], 0, SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE);
+        storage->tags[i] = 0;
+    }
+}
+//////////////////////////////////////////////////////////////////
+// Returns the slot of the least recently used unpinned page
+static int find_victim(const st_storage_t *storage)
+{
+    int victim = storage->pinned_count;
+    uint16_t oldest = 0;
+    for (int i = storage->pinned_count; i < SEQUENCE_TRANSFORM_STORAGE_PAGE_COUNT; ++i) {
+        if (!storage->tags[i]) {
+            return i;
+        }
+        // ages are relative to the clock, so wrapping around is fine
+        const uint16_t age = storage->clock - storage->last_used[i];
+        if (age > oldest) {
+            oldest = age;
+            victim = i;
+        }
+    }
+    return victim;
+}
+//////////////////////////////////////////////////////////////////
+// Keeps the page holding address in the cache for good.
+// Returns false if all the pinned pages are in use.
+bool st_storage_pin(st_storage_t *storage, uint32_t address)
+{
+    const uint32_t tag = (address & ~PAGE_MASK) + 1;
+    for (int i = 0; i < storage->pinned_count; ++i) {
+        if (storage->tags[i] == tag) {
+            return true;
+        }
+    }
+    if (storage->pinned_count == SEQUENCE_TRANSFORM_STORAGE_PINNED_PAGES) {
+        return false;
+    }
+    const int i = storage->pinned_count++;
+    // an unpinned copy would be a stale duplicate
+    for (int j = i; j < SEQUENCE_TRANSFORM_STORAGE_PAGE_COUNT; ++j) {
+        if (storage->tags[j] == tag) {
+            storage->tags[j] = 0;
+        }
+    }
+    load_page(storage, i, tag - 1);
+    storage->recent = i;
+    return true;
+}
+//////////////////////////////////////////////////////////////////
+uint8_t st_storage_read_byte(st_storage_t *storage, uint32_t address)
+{
+    const uint32_t tag = (address & ~PAGE_MASK) + 1;
+#ifdef ST_TESTER
+    ++storage->reads;
+#endif
+    // Most reads walk through the same node
+    int i = storage->recent;
+    if (storage->tags[i] != tag) {
+        for (i = 0; i < SEQUENCE_TRANSFORM_STORAGE_PAGE_COUNT && storage->tags[i] != tag; ++i);
+        if (i == SEQUENCE_TRANSFORM_STORAGE_PAGE_COUNT) {
+#ifdef ST_TESTER
+            ++storage->misses;
+#endif
+            i = find_victim(storage);
+            load_page(storage, i, tag - 1);
+        }
+        storage->recent = i;
+    }
+    storage->last_used[i] = ++storage->clock;
+    return storage->pages[i][address & PAGE_MASK];
+}
+
+#endif
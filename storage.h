@@ -0,0 +1,45 @@
+// Copyright 2024 Guillaume Stordeur <guillaume.stordeur@gmail.com>
+// Copyright 2024 Matt Skalecki <ikcelaks@gmail.com>
+// Copyright 2024 QKekos <q.kekos.q@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "st_defaults.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+//////////////////////////////////////////////////////////////////
+// Public API
+
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+
+// Reads `size` bytes at `address` of the device into `dest`.
+// Returns false if the device couldn't be read.
+typedef bool (*st_storage_read_fn_t)(void *context, uint32_t address, uint8_t *dest, int size);
+
+typedef struct st_storage_t
+{
+    st_storage_read_fn_t    read;           // device driver
+    void                    *context;       // passed to read
+    uint8_t                 pages[SEQUENCE_TRANSFORM_STORAGE_PAGE_COUNT][SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE];
+    uint32_t                tags[SEQUENCE_TRANSFORM_STORAGE_PAGE_COUNT];        // page address + 1 (0 if empty)
+    uint16_t                last_used[SEQUENCE_TRANSFORM_STORAGE_PAGE_COUNT];   // clock of the last read
+    uint16_t                clock;
+    uint8_t                 recent;         // page of the last read
+    uint8_t                 pinned_count;   // pages [0, pinned_count) are never evicted
+#ifdef ST_TESTER
+    long                    reads;
+    long                    misses;
+#endif
+} st_storage_t;
+
+void    st_storage_init(st_storage_t *storage, st_storage_read_fn_t read, void *context);
+void    st_storage_reset(st_storage_t *storage);
+bool    st_storage_pin(st_storage_t *storage, uint32_t address);
+uint8_t st_storage_read_byte(st_storage_t *storage, uint32_t address);
+
+#else
+
+typedef struct st_storage_t st_storage_t;
+
+#endif
@@ -91,12 +91,19 @@ uint8_t get_mods(void)
     return 0;
 }
 //////////////////////////////////////////////////////////////////////
+// Simulated time, which only moves when a test advances it
+static uint32_t sim_time = 0;
 uint32_t timer_read32(void)
 {
-    return 0;
+    return sim_time;
 }
 //////////////////////////////////////////////////////////////////////
 uint32_t timer_elapsed32(uint32_t tlast)
 {
-    return 0;
+    return sim_time - tlast;
+}
+//////////////////////////////////////////////////////////////////////
+void sim_advance_time(uint32_t ms)
+{
+    sim_time += ms;
 }
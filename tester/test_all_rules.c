@@ -3,11 +3,33 @@
 // Copyright 2024 QKekos <q.kekos.q@gmail.com>
 // SPDX-License-Identifier: Apache-2.0
 
+#include <stdlib.h>
 #include "qmk_wrapper.h"
 #include "key_stack.h"
 #include "tester.h"
 #include "sequence_transform_test.h"
 #include "tester_utils.h"
+#ifndef WIN32
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#endif
+
+// Rules to test: the generated ones, unless replaced by a loaded blob
+static const uint8_t **test_sequences = st_test_sequences;
+static const uint8_t **test_transforms = st_test_transforms;
+
+//////////////////////////////////////////////////////////////////////
+void set_test_rules(const uint8_t **sequences, const uint8_t **transforms)
+{
+    test_sequences = sequences;
+    test_transforms = transforms;
+}
+
+typedef struct {
+    int pass;
+    int warns;
+} st_test_shard_result_t;
 
 //////////////////////////////////////////////////////////////////
 static const char *test_result_str[] = {
@@ -23,6 +45,10 @@ static st_test_info_t rule_tests[] = {
     { test_virtual_output,  "st_virtual_output",    { false, {0} } },
 	{ test_cursor,          "st_cursor",            { false, {0} } },
     { test_backspace,       "st_handle_backspace",  { false, {0} } },
+    { test_undo,            "st_undo",              { false, {0} } },
+#if SEQUENCE_TRANSFORM_BACKSPACE_REPEAT > 0
+    { test_backspace_repeat, "st_engine_task",      { false, {0} } },
+#endif
     // { test_find_rule,       "st_find_missed_rule",  { false, {0} } },
     { 0,                    0,                      { false, {0} } }
 };
@@ -34,16 +60,22 @@ void print_available_tests(void)
         printf("       #%d %s\n", i+1, rule_tests[i].name);
     }
 }
+#define RULE_TEST_COUNT (sizeof(rule_tests) / sizeof(st_test_info_t) - 1)
+
+// Results of all tests of one rule, kept until they can be printed
+typedef struct {
+    st_result_code_t    codes[RULE_TEST_COUNT];
+    char                *messages[RULE_TEST_COUNT];    // only set for failures and warnings
+} st_rule_results_t;
+
 //////////////////////////////////////////////////////////////////////
-int test_rule(const st_test_rule_t *rule,
-              bool *tests,
-              bool print_all,
-              int *warns)
+void run_rule_tests(const st_test_rule_t *rule,
+                    bool *tests,
+                    st_rule_results_t *results)
 {
-    // Call all the tests and gather results
-    bool all_pass = true;
-    bool print = print_all;
     for (int i = 0; rule_tests[i].func; ++i) {
+        results->codes[i] = TEST_OK;
+        results->messages[i] = 0;
         if (!tests[i]) {
             continue;
         }
@@ -53,11 +85,30 @@ int test_rule(const st_test_rule_t *rule,
         res->message[0] = 0;
         // call test
         rule_tests[i].func(rule, res);
-        // examine result
-        if (res->code == TEST_FAIL) {
+        results->codes[i] = res->code;
+        if (res->code != TEST_OK) {
+            results->messages[i] = strdup(res->message);
+        }
+    }
+}
+//////////////////////////////////////////////////////////////////////
+int print_rule_results(const st_test_rule_t *rule,
+                       bool *tests,
+                       bool print_all,
+                       st_rule_results_t *results,
+                       int *warns)
+{
+    // Examine results
+    bool all_pass = true;
+    bool print = print_all;
+    for (int i = 0; rule_tests[i].func; ++i) {
+        if (!tests[i]) {
+            continue;
+        }
+        if (results->codes[i] == TEST_FAIL) {
             all_pass = false;
             print = true;
-        } else if (res->code == TEST_WARN) {
+        } else if (results->codes[i] == TEST_WARN) {
             print = true;
             *warns = *warns + 1;
         }
@@ -75,19 +126,171 @@ int test_rule(const st_test_rule_t *rule,
         if (!tests[i]) {
             continue;
         }
-        const st_test_info_t *test = &rule_tests[i];
-        const bool pass = test->res.code == TEST_OK;
+        const bool pass = results->codes[i] == TEST_OK;
         if (print_all || !pass) {
             printf("%s %s() %s\n",
-                   test_result_str[test->res.code],
-                   test->name,
-                   pass ? "OK!" : test->res.message);
+                   test_result_str[results->codes[i]],
+                   rule_tests[i].name,
+                   pass ? "OK!" : results->messages[i]);
         }
+        free(results->messages[i]);
     }
     puts("");
     return all_pass ? 1 : 0;
 }
 //////////////////////////////////////////////////////////////////////
+int test_rule(const st_test_rule_t *rule,
+              bool *tests,
+              bool print_all,
+              int *warns)
+{
+    st_rule_results_t results;
+    run_rule_tests(rule, tests, &results);
+    return print_rule_results(rule, tests, print_all, &results, warns);
+}
+//////////////////////////////////////////////////////////////////////
+static int compare_rule_sequences(const void *a, const void *b)
+{
+    return strcmp((const char *)test_sequences[*(const int *)a],
+                  (const char *)test_sequences[*(const int *)b]);
+}
+//////////////////////////////////////////////////////////////////////
+void test_rule_range(int first,
+                     int last,
+                     bool *tests,
+                     bool print_all,
+                     st_test_shard_result_t *res)
+{
+    // Apply tests to each rule, created from
+    // sequence_transform_test.h arrays generated by script
+    // (or the test rules of a loaded blob)
+    const int count = last - first;
+    int *order = malloc(count * sizeof(int));
+    st_rule_results_t *results = malloc(count * sizeof(st_rule_results_t));
+    if (!sim_checkpoints_enabled || !order || !results) {
+        free(order);
+        free(results);
+        for (int i = first; i < last; ++i) {
+            st_test_rule_t rule = {
+                test_sequences[i],
+                test_transforms[i]
+            };
+            res->pass += test_rule(&rule,
+                                   tests,
+                                   print_all,
+                                   &res->warns);
+        }
+        return;
+    }
+    // Test the rules sorted by sequence, so that each one shares
+    // the longest possible prefix with the checkpointed key presses
+    // of the previous one (see sim_st_perform)
+    for (int i = 0; i < count; ++i) {
+        order[i] = first + i;
+    }
+    qsort(order, count, sizeof(int), compare_rule_sequences);
+    for (int i = 0; i < count; ++i) {
+        st_test_rule_t rule = {
+            test_sequences[order[i]],
+            test_transforms[order[i]]
+        };
+        run_rule_tests(&rule, tests, &results[order[i] - first]);
+    }
+    // Print results in rule order
+    for (int i = 0; i < count; ++i) {
+        st_test_rule_t rule = {
+            test_sequences[first + i],
+            test_transforms[first + i]
+        };
+        res->pass += print_rule_results(&rule,
+                                        tests,
+                                        print_all,
+                                        &results[i],
+                                        &res->warns);
+    }
+    free(order);
+    free(results);
+}
+//////////////////////////////////////////////////////////////////////
+// Splits the rules into `jobs` consecutive shards, each tested by
+// a forked worker that writes its output to a temp file.
+// Outputs are then copied to stdout in shard order, so they read
+// the same as a single process run.
+// Shards that can't get a worker are tested in-process when their
+// turn comes.
+void test_rules_in_workers(int rules,
+                           int jobs,
+                           bool *tests,
+                           bool print_all,
+                           st_test_shard_result_t *total)
+{
+#ifdef WIN32
+    jobs = 1;
+#endif
+    if (jobs <= 1) {
+        test_rule_range(0, rules, tests, print_all, total);
+        return;
+    }
+#ifndef WIN32
+    // Workers report their counts through shared memory
+    st_test_shard_result_t *results = mmap(NULL, jobs * sizeof(st_test_shard_result_t),
+                                           PROT_READ | PROT_WRITE,
+                                           MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (results == MAP_FAILED) {
+        test_rule_range(0, rules, tests, print_all, total);
+        return;
+    }
+    FILE  *outputs[jobs];
+    pid_t pids[jobs];
+    // don't let workers inherit pending output
+    fflush(stdout);
+    for (int j = 0; j < jobs; ++j) {
+        results[j].pass = 0;
+        results[j].warns = 0;
+        pids[j] = -1;
+        outputs[j] = tmpfile();
+        if (!outputs[j]) {
+            continue;
+        }
+        pids[j] = fork();
+        if (pids[j] == 0) {
+            dup2(fileno(outputs[j]), STDOUT_FILENO);
+            test_rule_range(rules * j / jobs, rules * (j + 1) / jobs,
+                             tests, print_all, &results[j]);
+            fflush(stdout);
+            _exit(0);
+        }
+        if (pids[j] < 0) {
+            fclose(outputs[j]);
+        }
+    }
+    // Merge outputs and counts in rule order
+    for (int j = 0; j < jobs; ++j) {
+        const int first = rules * j / jobs, last = rules * (j + 1) / jobs;
+        if (pids[j] < 0) {
+            test_rule_range(first, last, tests, print_all, &results[j]);
+        } else {
+            int status = 0;
+            waitpid(pids[j], &status, 0);
+            rewind(outputs[j]);
+            char buf[4096];
+            for (size_t n; (n = fread(buf, 1, sizeof(buf), outputs[j])) > 0; ) {
+                fwrite(buf, 1, n, stdout);
+            }
+            fclose(outputs[j]);
+            if (!WIFEXITED(status) || WEXITSTATUS(status)) {
+                // untested rules of the shard will count as failures
+                printf("\033[0;31mWorker testing rules %d to %d crashed!\033[0m\n\n",
+                       first + 1, last);
+            }
+        }
+        total->pass += results[j].pass;
+        total->warns += results[j].warns;
+    }
+    munmap(results, jobs * sizeof(st_test_shard_result_t));
+#endif
+}
+//////////////////////////////////////////////////////////////////////
 int test_all_rules(const st_test_options_t *options)
 {
     // Determine which tests should be run
@@ -100,19 +303,17 @@ int test_all_rules(const st_test_options_t *options)
             tests[i] = false;
         }
     }
-    // Apply tests to each rule, created from
-    // sequence_transform_test.h arrays generated by script
-    int rules = 0, pass = 0, warns = 0;
-    for (; st_test_sequences[rules]; ++rules) {
-        st_test_rule_t rule = {
-            st_test_sequences[rules],
-            st_test_transforms[rules]
-        };
-        pass += test_rule(&rule,
+    int rules = 0;
+    while (test_sequences[rules]) {
+        ++rules;
+    }
+    st_test_shard_result_t res = {0, 0};
+    test_rules_in_workers(rules,
+                          options->jobs < rules ? options->jobs : rules,
                           tests,
                           options->print_all,
-                          &warns);
-    }
+                          &res);
+    const int pass = res.pass, warns = res.warns;
     // Show tests performed and stats
     printf("--- TEST SUMMARY ---\n");
     printf("Rules tested: %d\n", rules);
@@ -9,6 +9,7 @@
 #include "sequence_transform.h"
 #include "utils.h"
 #include "tester_utils.h"
+#include "latency.h"
 #include "tester.h"
 
 //////////////////////////////////////////////////////////////////////
@@ -31,7 +32,7 @@ int test_ascii_string(const st_test_options_t *options)
          // handle backspace (ST does not call st_perform in this case)
         if (key == KC_BSPC) {
             tap_code16(key);
-            st_handle_backspace();
+            st_log_time(ST_LATENCY_BACKSPACE, st_handle_backspace(st_get_engine()));
             st_key_buffer_print(buf);
             st_key_stack_print(&sim_output);
             st_cursor_t *cursor = st_get_cursor();
@@ -43,11 +44,14 @@ int test_ascii_string(const st_test_options_t *options)
         st_key_buffer_push(buf, st_keycode_to_triecode(key, TEST_KC_SEQ_TOKEN_0));
         st_key_buffer_print(buf);
         // let sequence transform do its thing!
-        if (!st_perform()) {
+        bool performed;
+        st_log_time_with_result(ST_LATENCY_PERFORM, st_perform(st_get_engine()), &performed);
+        if (!performed) {
             // st_perform didn't do anything special with this key,
             // so we must add it to the output buffer
             tap_code16(key);
         }
+        st_trace_print_new();
         st_key_stack_print(&sim_output);
         st_cursor_t *cursor = st_get_cursor();
         st_cursor_init(cursor, 0, true);
@@ -55,7 +59,7 @@ int test_ascii_string(const st_test_options_t *options)
         // check for missed rule
         missed_rule_seq[0] = 0;
         missed_rule_transform[0] = 0;
-        st_find_missed_rule();
+        st_find_missed_rule(st_get_engine());
         if (strlen(missed_rule_seq)) {
             printf("Missed rule: %s ⇒ %s\n",
                     missed_rule_seq, missed_rule_transform);
@@ -5,27 +5,124 @@
 
 #include "st_defaults.h"
 #include "qmk_wrapper.h"
+#include "utils.h"
+#include "triecodes.h"
 #include "sequence_transform.h"
 #include "tester.h"
 
-//////////////////////////////////////////////////////////////////
-// (partial) simulation of process_sequence_transform logic
-// to test enhanced backspace
-void sim_st_enhanced_backspace(const uint8_t *triecodes)
+//////////////////////////////////////////////////////////////////////
+// Output after each number of keys of the rule sequence
+#define PREFIX_MAX 128
+static uint8_t prefix_output[PREFIX_MAX][256];
+static int prefix_output_size[PREFIX_MAX];
+
+//////////////////////////////////////////////////////////////////////
+// Fills prefix_output with the output of each shorter prefix of the
+// rule sequence. Returns the sequence length, or -1 if it's too long.
+static int sim_prefix_outputs(const st_test_rule_t *rule)
 {
-    while (*triecodes++) {
-        tap_code16(KC_BSPC);
-        st_handle_backspace();
+    uint8_t prefix[PREFIX_MAX] = {0};
+    const int len = strlen((const char *)rule->sequence);
+    if (len >= PREFIX_MAX) {
+        return -1;
+    }
+    for (int i = 1; i < len; ++i) {
+        prefix[i - 1] = rule->sequence[i - 1];
+        sim_st_perform(prefix);
+        memcpy(prefix_output[i], sim_output.buffer, sim_output.size);
+        prefix_output_size[i] = sim_output.size;
     }
+    prefix_output_size[0] = 0;
+    return len;
+}
+//////////////////////////////////////////////////////////////////////
+static bool sim_output_matches_prefix(int i)
+{
+    return sim_output.size == prefix_output_size[i] &&
+        !memcmp(sim_output.buffer, prefix_output[i], sim_output.size);
 }
 //////////////////////////////////////////////////////////////////////
 void test_backspace(const st_test_rule_t *rule, st_test_result_t *res)
 {
+    const int len = sim_prefix_outputs(rule);
+    if (len < 0) {
+        RES_WARN("sequence too long to test");
+        return;
+    }
+    sim_st_perform(rule->sequence);
+    // Each backspace should undo exactly one key press, so the output
+    // matches what it was before that key, down to an empty output
+    // after one backspace for every key sent
+    for (int i = len - 1; i >= 0; --i) {
+        tap_code16(KC_BSPC);
+        st_handle_backspace(st_get_engine());
+        if (!sim_output_matches_prefix(i)) {
+            RES_FAIL("output after undoing to key %d differs from when it was typed", i);
+            return;
+        }
+    }
+}
+//////////////////////////////////////////////////////////////////////
+// Same as test_backspace, with bursts of backspaces undone at once
+void test_undo(const st_test_rule_t *rule, st_test_result_t *res)
+{
+    const int len = sim_prefix_outputs(rule);
+    if (len < 0) {
+        RES_WARN("sequence too long to test");
+        return;
+    }
+    uint8_t batch_output_data[256];
+    st_feed_batch_t batch = {{batch_output_data, sizeof(batch_output_data), 0}, 0, 0};
+    for (int burst = 1; burst <= len; ++burst) {
+        sim_st_perform(rule->sequence);
+        const int undone = st_engine_undo(st_get_engine(), burst, &batch);
+        if (undone != burst) {
+            RES_FAIL("undid %d of a burst of %d keys", undone, burst);
+            return;
+        }
+        st_multi_tap(KC_BSPC, batch.backspaces);
+        for (int i = 0; i < batch.output.size; ++i) {
+            st_send_key(st_ascii_to_keycode(batch.output.buffer[i]));
+        }
+        if (!sim_output_matches_prefix(len - burst)) {
+            RES_FAIL("output after undoing a burst of %d keys differs from when they were typed", burst);
+            return;
+        }
+    }
+}
+#if SEQUENCE_TRANSFORM_BACKSPACE_REPEAT > 0
+//////////////////////////////////////////////////////////////////////
+// Same as test_backspace, with the backspace key held down. The press
+// isn't passed on, so it has to undo the last key without post processing,
+// then every repeat sent by st_engine_task undoes one more.
+void test_backspace_repeat(const st_test_rule_t *rule, st_test_result_t *res)
+{
+    const int len = sim_prefix_outputs(rule);
+    if (len < 0) {
+        RES_WARN("sequence too long to test");
+        return;
+    }
+    st_engine_t *engine = st_get_engine();
     sim_st_perform(rule->sequence);
-    // Make sure enhanced backspace handling leaves us with an empty
-    // output buffer if we send one backspace for every key sent
-    sim_st_enhanced_backspace(rule->sequence);
-    if (sim_output.size != 0) {
-        RES_FAIL("left %d keys in buffer!", sim_output.size);
+    keyrecord_t record;
+    memset(&record, 0, sizeof(record));
+    record.event.pressed = true;
+    if (st_engine_process(engine, KC_BSPC, &record, TEST_KC_SEQ_TOKEN_0)) {
+        RES_FAIL("backspace press was passed on");
+        return;
+    }
+    for (int i = len - 1; i >= 0; --i) {
+        if (i < len - 1) {
+            // the first repeat comes after the tapping term
+            sim_advance_time(1 + (i == len - 2 ? TAPPING_TERM : SEQUENCE_TRANSFORM_BACKSPACE_REPEAT));
+            st_engine_task(engine);
+        }
+        if (!sim_output_matches_prefix(i)) {
+            RES_FAIL("output after undoing to key %d differs from when it was typed", i);
+            break;
+        }
     }
+    record.event.pressed = false;
+    st_engine_process(engine, KC_BSPC, &record, TEST_KC_SEQ_TOKEN_0);
 }
+#endif
@@ -51,7 +51,7 @@ bool setup_input_from_transform(const st_test_rule_t *rule, char *chained_transf
     uint8_t key = 0;
     do {
         tap_code16(KC_BSPC);
-        st_handle_backspace();
+        st_handle_backspace(st_get_engine());
         key = TRIECODE_AT(0);
     } while (key && !st_is_seq_token_triecode(key));
     if (!key) {
@@ -114,7 +114,7 @@ void test_find_rule(const st_test_rule_t *rule, st_test_result_t *res)
     // from this new input buffer, find missed rule
     missed_rule_seq[0] = 0;
     missed_rule_transform[0] = 0;
-    st_find_missed_rule();
+    st_find_missed_rule(st_get_engine());
     // Check if found rule matches ours
     st_triecodes_to_ascii_str(rule->sequence, seq_ascii);
     const int missed_rule_seq_len = strlen(missed_rule_seq);
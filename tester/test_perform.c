@@ -11,25 +11,130 @@
 #include "tester_utils.h"
 #include "utils.h"
 
+#define SIM_CHECKPOINT_MAX 64
+#define SIM_BUFFER_MAX     256
+
+// Simulation state after some number of key presses
+typedef struct {
+    st_key_action_t key_buffer_data[SIM_BUFFER_MAX];
+    uint8_t         seq_ref_cache[SIM_BUFFER_MAX * 2];
+    int             size;
+    int             head;
+    int             seq_ref_size;
+    int             seq_ref_head;
+    uint8_t         sim_output_buffer[SIM_BUFFER_MAX];
+    int             sim_output_size;
+    uint32_t        sim_output_checksum;
+#if SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE > 0
+    st_undo_entry_t undo_entries[SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE];
+    uint8_t         undo_text[SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE * SIM_BUFFER_MAX];
+    int             undo_head;
+    int             undo_size;
+    uint8_t         undo_output[SIM_BUFFER_MAX];
+    int             undo_output_head;
+    int             undo_output_size;
+#endif
+} st_sim_checkpoint_t;
+
+// checkpoints[i] holds the state after the first i keys of checkpoint_seq
+static st_sim_checkpoint_t checkpoints[SIM_CHECKPOINT_MAX + 1];
+static uint8_t checkpoint_seq[SIM_CHECKPOINT_MAX];
+static int checkpoint_count = 0;
+bool sim_checkpoints_enabled = true;
+
+//////////////////////////////////////////////////////////////////
+void sim_checkpoint_save(st_sim_checkpoint_t *checkpoint)
+{
+    const st_key_buffer_t *buf = st_get_key_buffer();
+    memcpy(checkpoint->key_buffer_data, buf->data, buf->capacity * sizeof(st_key_action_t));
+    memcpy(checkpoint->seq_ref_cache, buf->seq_ref_cache, buf->seq_ref_capacity);
+    checkpoint->size = buf->size;
+    checkpoint->head = buf->head;
+    checkpoint->seq_ref_size = buf->seq_ref_size;
+    checkpoint->seq_ref_head = buf->seq_ref_head;
+    memcpy(checkpoint->sim_output_buffer, sim_output.buffer, sim_output.size);
+    checkpoint->sim_output_size = sim_output.size;
+    checkpoint->sim_output_checksum = sim_output_checksum;
+#if SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE > 0
+    const st_undo_journal_t *journal = &st_get_engine()->undo_journal;
+    memcpy(checkpoint->undo_entries, journal->entries, journal->capacity * sizeof(st_undo_entry_t));
+    memcpy(checkpoint->undo_text, journal->text, journal->capacity * journal->max_restore);
+    checkpoint->undo_head = journal->head;
+    checkpoint->undo_size = journal->size;
+    memcpy(checkpoint->undo_output, journal->output, journal->max_restore);
+    checkpoint->undo_output_head = journal->output_head;
+    checkpoint->undo_output_size = journal->output_size;
+#endif
+}
+//////////////////////////////////////////////////////////////////
+void sim_checkpoint_restore(const st_sim_checkpoint_t *checkpoint)
+{
+    st_key_buffer_t *buf = st_get_key_buffer();
+    memcpy(buf->data, checkpoint->key_buffer_data, buf->capacity * sizeof(st_key_action_t));
+    memcpy(buf->seq_ref_cache, checkpoint->seq_ref_cache, buf->seq_ref_capacity);
+    buf->size = checkpoint->size;
+    buf->head = checkpoint->head;
+    buf->seq_ref_size = checkpoint->seq_ref_size;
+    buf->seq_ref_head = checkpoint->seq_ref_head;
+    memcpy(sim_output.buffer, checkpoint->sim_output_buffer, checkpoint->sim_output_size);
+    sim_output.size = checkpoint->sim_output_size;
+    sim_output_checksum = checkpoint->sim_output_checksum;
+#if SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE > 0
+    st_undo_journal_t *journal = &st_get_engine()->undo_journal;
+    memcpy(journal->entries, checkpoint->undo_entries, journal->capacity * sizeof(st_undo_entry_t));
+    memcpy(journal->text, checkpoint->undo_text, journal->capacity * journal->max_restore);
+    journal->head = checkpoint->undo_head;
+    journal->size = checkpoint->undo_size;
+    memcpy(journal->output, checkpoint->undo_output, journal->max_restore);
+    journal->output_head = checkpoint->undo_output_head;
+    journal->output_size = checkpoint->undo_output_size;
+#endif
+    // the cursor's cached action may refer to a different buffer state
+    st_get_cursor()->cache_valid = 255;
+}
 //////////////////////////////////////////////////////////////////
 // (partial) simulation of process_sequence_transform logic
 // to test st_perform
+// Key presses are replayed from the last checkpoint sharing
+// a prefix with `sequence`, so calling this again for the same
+// sequence (or one sharing its prefix) skips repeated work.
 void sim_st_perform(const uint8_t *sequence)
 {
-    st_key_stack_reset(&sim_output);
-    // we don't use st_key_buffer_reset(buf) here because
-    // we don't nec want a space at the start of the buffer
     st_key_buffer_t *buf = st_get_key_buffer();
-    buf->size = 0;
-    for (uint8_t triecode = *sequence; triecode; triecode = *++sequence) {
-        triecode = st_get_metachar_example_triecode(triecode);
+    int i = 0;
+    if (sim_checkpoints_enabled && checkpoint_count) {
+        while (i < checkpoint_count - 1 && sequence[i] && sequence[i] == checkpoint_seq[i]) {
+            ++i;
+        }
+        sim_checkpoint_restore(&checkpoints[i]);
+    } else {
+        st_key_stack_reset(&sim_output);
+        // we don't use st_key_buffer_reset(buf) here because
+        // we don't nec want a space at the start of the buffer
+        buf->size = 0;
+#if SEQUENCE_TRANSFORM_UNDO_JOURNAL_SIZE > 0
+        st_undo_journal_reset(&st_get_engine()->undo_journal);
+#endif
+    }
+    checkpoint_count = i + 1;
+    if (sim_checkpoints_enabled && i == 0) {
+        sim_checkpoint_save(&checkpoints[0]);
+    }
+    for (; sequence[i]; ++i) {
+        const uint8_t triecode = st_get_metachar_example_triecode(sequence[i]);
         st_key_buffer_push(buf, triecode);
         // If st_perform doesn't do anything special with this key,
         // add it to our virtual output buffer
-        if (!st_perform()) {
+        if (!st_perform(st_get_engine())) {
             uint16_t keycode = st_triecode_to_keycode(triecode, TEST_KC_SEQ_TOKEN_0);
             tap_code16(keycode);
         }
+        st_trace_print_new();
+        if (sim_checkpoints_enabled && i < SIM_CHECKPOINT_MAX) {
+            checkpoint_seq[i] = sequence[i];
+            sim_checkpoint_save(&checkpoints[i + 1]);
+            checkpoint_count = i + 2;
+        }
     }
 }
 //////////////////////////////////////////////////////////////////////
@@ -0,0 +1,375 @@
+// Copyright 2024 Guillaume Stordeur <guillaume.stordeur@gmail.com>
+// Copyright 2024 Matt Skalecki <ikcelaks@gmail.com>
+// Copyright 2024 QKekos <q.kekos.q@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+
+#include <stdlib.h>
+#include <time.h>
+#include "st_defaults.h"
+#include "qmk_wrapper.h"
+#include "triecodes.h"
+#include "sequence_transform.h"
+#include "sequence_transform_data.h"
+#include "completions.h"
+#include "st_blob.h"
+#include "latency.h"
+#include "utils.h"
+#include "tester.h"
+
+typedef struct {
+    int         keys;
+    int         resets;
+    int         rejected;
+    int         transforms;
+    uint32_t    output_checksum;
+    uint32_t    text_checksum;
+    double      elapsed;
+    int         max_key_page_misses;    // most pages read from storage for one key
+} st_text_file_stats_t;
+
+#define FEED_CHUNK_SIZE 1024
+#define UNDO_BURST_SIZE 4
+
+typedef struct {
+    long        bursts;
+    long        taps;           // keys sent to undo the bursts
+    uint32_t    text_checksum;
+    double      elapsed;
+} st_undo_burst_stats_t;
+
+//////////////////////////////////////////////////////////////////////
+// Folds all but the `keep` most recent chars of the output into the
+// checksum of the output text, to make room for more output
+void commit_output_text(st_key_stack_t *output, uint32_t *checksum, int keep)
+{
+    const int count = output->size > keep ? output->size - keep : 0;
+    for (int i = 0; i < count; ++i) {
+        *checksum = (*checksum ^ output->buffer[i]) * 16777619UL;
+    }
+    memmove(output->buffer, output->buffer + count, output->size - count);
+    output->size -= count;
+}
+
+//////////////////////////////////////////////////////////////////////
+// (partial) simulation of process_sequence_transform logic
+// over every char of a text file
+void replay_text_file(FILE *file, st_text_file_stats_t *stats)
+{
+    rewind(file);
+    st_key_stack_reset(&sim_output);
+    sim_output_checksum = 0;
+    stats->text_checksum = 0;
+    st_key_buffer_t *buf = st_get_key_buffer();
+    st_engine_reset(st_get_engine());
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+    const st_storage_t *storage = st_get_trie()->storage;
+#endif
+    const clock_t start = clock();
+    for (int c = fgetc(file); c != EOF; c = fgetc(file)) {
+        if (c == '\n' || c == '\r' || c == '\t') {
+            c = ' ';
+        }
+        if (c < ' ' || c >= 127) {
+            // not something we can type; same as an unprocessable keycode
+            st_engine_reset(st_get_engine());
+            ++stats->resets;
+            continue;
+        }
+        // we only care about the recent output, so don't let it overflow
+        if (sim_output.size > sim_output.capacity / 2) {
+            commit_output_text(&sim_output, &stats->text_checksum, sim_output.capacity / 4);
+        }
+        ++stats->keys;
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+        const long misses = storage ? storage->misses : 0;
+#endif
+        st_key_buffer_push(buf, c);
+        if (!st_trie_can_trigger(st_get_trie(), buf)) {
+            ++stats->rejected;
+        }
+        bool performed;
+        st_log_time_with_result(ST_LATENCY_PERFORM, st_perform(st_get_engine()), &performed);
+        if (performed) {
+            ++stats->transforms;
+        } else {
+            tap_code16(st_ascii_to_keycode(c));
+        }
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+        if (storage && storage->misses - misses > stats->max_key_page_misses) {
+            stats->max_key_page_misses = storage->misses - misses;
+        }
+#endif
+    }
+    stats->elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+    stats->output_checksum = sim_output_checksum;
+    commit_output_text(&sim_output, &stats->text_checksum, 0);
+}
+//////////////////////////////////////////////////////////////////////
+// Same replay, feeding the keys in chunks through st_engine_feed_keys
+void replay_text_file_batched(FILE *file, st_text_file_stats_t *stats)
+{
+    fseek(file, 0, SEEK_END);
+    const long size = ftell(file);
+    rewind(file);
+    uint8_t *keys = malloc(size);
+    const long count = fread(keys, 1, size, file);
+    for (long i = 0; i < count; ++i) {
+        if (keys[i] == '\n' || keys[i] == '\r' || keys[i] == '\t') {
+            keys[i] = ' ';
+        } else if (keys[i] < ' ' || keys[i] >= 127) {
+            keys[i] = 0;
+        }
+    }
+    static uint8_t batch_output_data[FEED_CHUNK_SIZE];
+    static uint8_t text_data[FEED_CHUNK_SIZE * 2];
+    st_feed_batch_t batch = {{batch_output_data, FEED_CHUNK_SIZE, 0}, 0, 0};
+    st_key_stack_t text = {text_data, FEED_CHUNK_SIZE * 2, 0};
+    stats->text_checksum = 0;
+    st_engine_t *engine = st_get_engine();
+    st_engine_reset(engine);
+    const clock_t start = clock();
+    for (long i = 0; i < count; ) {
+        i += st_engine_feed_keys(engine, keys + i, count - i, &batch);
+        stats->transforms += batch.transforms;
+        text.size -= batch.backspaces < text.size ? batch.backspaces : text.size;
+        memcpy(text.buffer + text.size, batch.output.buffer, batch.output.size);
+        text.size += batch.output.size;
+        commit_output_text(&text, &stats->text_checksum, sim_output.capacity / 4);
+    }
+    stats->elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+    commit_output_text(&text, &stats->text_checksum, 0);
+    for (long i = 0; i < count; ++i) {
+        stats->keys += keys[i] != 0;
+    }
+    free(keys);
+}
+//////////////////////////////////////////////////////////////////////
+// Types one key of a replay, as process_sequence_transform would
+static bool replay_key(st_key_buffer_t *buf, uint8_t c)
+{
+    st_key_buffer_push(buf, c);
+    if (st_perform(st_get_engine())) {
+        return true;
+    }
+    tap_code16(st_ascii_to_keycode(c));
+    return false;
+}
+//////////////////////////////////////////////////////////////////////
+// Same replay, but after every transform the last UNDO_BURST_SIZE keys
+// are backspaced over and typed again, either undoing one key at a
+// time like tapping backspace does, or all at once with st_engine_undo.
+// The output text should be the same as without the bursts.
+void replay_undo_bursts(FILE *file, bool bulk, st_undo_burst_stats_t *stats)
+{
+    rewind(file);
+    st_key_stack_reset(&sim_output);
+    stats->text_checksum = 0;
+    st_engine_t *engine = st_get_engine();
+    st_key_buffer_t *buf = &engine->key_buffer;
+    st_engine_reset(engine);
+    uint8_t batch_output_data[FEED_CHUNK_SIZE];
+    st_feed_batch_t batch = {{batch_output_data, FEED_CHUNK_SIZE, 0}, 0, 0};
+    uint8_t burst[UNDO_BURST_SIZE];
+    const clock_t start = clock();
+    for (int c = fgetc(file); c != EOF; c = fgetc(file)) {
+        if (c == '\n' || c == '\r' || c == '\t') {
+            c = ' ';
+        }
+        if (c < ' ' || c >= 127) {
+            st_engine_reset(engine);
+            continue;
+        }
+        if (sim_output.size > sim_output.capacity / 2) {
+            commit_output_text(&sim_output, &stats->text_checksum, sim_output.capacity / 4);
+        }
+        // the buffer doesn't keep the case of the keys, so remember them
+        memmove(burst, burst + 1, UNDO_BURST_SIZE - 1);
+        burst[UNDO_BURST_SIZE - 1] = c;
+        if (!replay_key(buf, c) || buf->size <= UNDO_BURST_SIZE) {
+            continue;
+        }
+        const long taps = sim_output_taps;
+        if (bulk) {
+            st_engine_undo(engine, UNDO_BURST_SIZE, &batch);
+            st_multi_tap(KC_BSPC, batch.backspaces);
+            for (int i = 0; i < batch.output.size; ++i) {
+                st_send_key(st_ascii_to_keycode(batch.output.buffer[i]));
+            }
+        } else {
+            for (int i = 0; i < UNDO_BURST_SIZE; ++i) {
+                tap_code16(KC_BSPC);
+                st_log_time(ST_LATENCY_BACKSPACE, st_handle_backspace(engine));
+            }
+        }
+        stats->taps += sim_output_taps - taps;
+        ++stats->bursts;
+        for (int i = 0; i < UNDO_BURST_SIZE; ++i) {
+            replay_key(buf, burst[i]);
+        }
+    }
+    stats->elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+    commit_output_text(&sim_output, &stats->text_checksum, 0);
+}
+//////////////////////////////////////////////////////////////////////
+// Decodes every completion sized window of the completions data
+// and returns the time per triecode in ns
+double time_completion_decode(void)
+{
+    const st_trie_t *trie = st_get_trie();
+    // size of the completions before entropy coding
+    const int size = loaded_blob ? loaded_blob->stats[ST_BLOB_COMPLETIONS_SIZE] : COMPLETIONS_SIZE;
+    const int max_len = trie->completion_max_len;
+    uint8_t completion[256];
+    long decoded = 0;
+    const clock_t start = clock();
+    for (int rep = 0; rep < 100; ++rep) {
+        for (int i = 0; i < size; ++i) {
+            const int len = i + max_len < size ? max_len : size - i;
+            st_completion_decode(trie, i, len, completion);
+            decoded += len;
+        }
+    }
+    const double elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+    return decoded ? 1e9 * elapsed / decoded : 0.0;
+}
+//////////////////////////////////////////////////////////////////////
+int test_text_file(const st_test_options_t *options)
+{
+    FILE *file = fopen(options->text_file, "rb");
+    if (!file) {
+        printf("Unable to open %s\n", options->text_file);
+        return 1;
+    }
+    st_text_file_stats_t stats = {0};
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+    // Replay once reading the mapped blob directly to compare against
+    st_storage_t *storage = loaded_blob ? loaded_blob->trie.storage : 0;
+    st_text_file_stats_t direct_stats = {0};
+    if (storage) {
+        loaded_blob->trie.storage = 0;
+        replay_text_file(file, &direct_stats);
+        loaded_blob->trie.storage = storage;
+    }
+#endif
+#if SEQUENCE_TRANSFORM_HOST_SIMD
+    // Replay once without the snapshot compares to compare against
+    st_text_file_stats_t scalar_stats = {0};
+    st_get_cursor()->snapshot_disabled = true;
+    replay_text_file(file, &scalar_stats);
+    st_get_cursor()->snapshot_disabled = false;
+#endif
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+    // Replay once without the no-match cache to compare against
+    st_no_match_cache_t *cache = st_get_no_match_cache();
+    st_text_file_stats_t uncached_stats = {0};
+    cache->disabled = true;
+    replay_text_file(file, &uncached_stats);
+    cache->disabled = false;
+    st_no_match_cache_reset(cache);
+#endif
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+    if (storage) {
+        storage->reads = storage->misses = 0;
+        loaded_blob->device_seconds = 0;
+    }
+#endif
+#if SEQUENCE_TRANSFORM_LATENCY_HISTOGRAMS
+    // st_perform is timed in the main replay only. The later replays
+    // add their trie searches, and the backspace burst replay that
+    // undoes one key at a time adds the backspaces.
+    st_latency_reset();
+#endif
+    replay_text_file(file, &stats);
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+    const long page_reads = storage ? storage->reads : 0;
+    const long page_misses = storage ? storage->misses : 0;
+    const double device_seconds = storage ? loaded_blob->device_seconds : 0;
+#endif
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+    const long cache_hits = cache->hits;
+    const long cache_lookups = cache->lookups;
+    st_no_match_cache_reset(cache);
+#endif
+    st_text_file_stats_t batched_stats = {0};
+    replay_text_file_batched(file, &batched_stats);
+    st_undo_burst_stats_t tapped_undo_stats = {0};
+    st_undo_burst_stats_t bulk_undo_stats = {0};
+    replay_undo_bursts(file, false, &tapped_undo_stats);
+    replay_undo_bursts(file, true, &bulk_undo_stats);
+    fclose(file);
+    // Show stats
+    printf("--- TEXT FILE SUMMARY ---\n");
+    printf("Trie size: %d bytes (%s)\n", st_get_trie()->data_size,
+           SEQUENCE_TRANSFORM_TRIE_ALIGNED ? "word aligned" : "packed");
+    printf("Completions size: %d bytes (%s, %.1f ns/triecode to decode)\n",
+           st_get_trie()->completions_size,
+           SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS ? "entropy coded" : "raw",
+           time_completion_decode());
+    printf("Keys replayed: %d\n", stats.keys);
+    printf("Buffer resets: %d\n", stats.resets);
+    printf("Transforms performed: %d\n", stats.transforms);
+    printf("Keys rejected by trigger filter: %d (%.1f%%)\n",
+           stats.rejected, stats.keys ? 100.0 * stats.rejected / stats.keys : 0.0);
+    // pushing past the end of the stack asserts, so this only shows the headroom
+    printf("Multi-branch backtrack depth: %d (bound %d)\n",
+           st_get_cursor()->branch_stack_max, st_get_cursor()->branch_stack_size);
+    printf("Time: %.3fs (%.0f keys/s)\n",
+           stats.elapsed, stats.elapsed > 0 ? stats.keys / stats.elapsed : 0.0);
+    printf("Time fed in batches: %.3fs (%.0f keys/s)\n",
+           batched_stats.elapsed, batched_stats.elapsed > 0 ? batched_stats.keys / batched_stats.elapsed : 0.0);
+    if (stats.transforms != batched_stats.transforms
+            || stats.text_checksum != batched_stats.text_checksum) {
+        printf("\033[0;31mOutput changed when feeding keys in batches!\033[0m\n");
+        return 1;
+    }
+    printf("Backspace bursts of %d keys: %ld (%.2f keys sent each one key at a time, %.2f with st_engine_undo)\n",
+           UNDO_BURST_SIZE, bulk_undo_stats.bursts,
+           tapped_undo_stats.bursts ? (double)tapped_undo_stats.taps / tapped_undo_stats.bursts : 0.0,
+           bulk_undo_stats.bursts ? (double)bulk_undo_stats.taps / bulk_undo_stats.bursts : 0.0);
+    printf("Time with backspace bursts: %.3fs one key at a time, %.3fs with st_engine_undo\n",
+           tapped_undo_stats.elapsed, bulk_undo_stats.elapsed);
+    if (tapped_undo_stats.text_checksum != stats.text_checksum
+            || bulk_undo_stats.text_checksum != stats.text_checksum) {
+        printf("\033[0;31mOutput changed when undoing bursts of backspaces!\033[0m\n");
+        return 1;
+    }
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+    if (storage) {
+        printf("Page cache: %d pages of %d bytes (%d pinned)\n", SEQUENCE_TRANSFORM_STORAGE_PAGE_COUNT,
+               SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE, storage->pinned_count);
+        printf("Page cache hits: %ld of %ld reads (%.2f%%)\n", page_reads - page_misses, page_reads,
+               page_reads ? 100.0 * (page_reads - page_misses) / page_reads : 0.0);
+        printf("Pages loaded per key: %.3f (max %d)\n",
+               stats.keys ? (double)page_misses / stats.keys : 0.0, stats.max_key_page_misses);
+        printf("Added latency per key: %.0f ns (%.0f ns reading the device)\n",
+               stats.keys ? 1e9 * (stats.elapsed - direct_stats.elapsed) / stats.keys : 0.0,
+               stats.keys ? 1e9 * device_seconds / stats.keys : 0.0);
+        if (stats.transforms != direct_stats.transforms
+                || stats.output_checksum != direct_stats.output_checksum) {
+            printf("\033[0;31mOutput changed when reading through the page cache!\033[0m\n");
+            return 1;
+        }
+    }
+#endif
+#if SEQUENCE_TRANSFORM_HOST_SIMD
+    printf("Time without snapshot compares: %.3fs (saved %.3fs)\n",
+           scalar_stats.elapsed, scalar_stats.elapsed - stats.elapsed);
+    if (stats.transforms != scalar_stats.transforms
+            || stats.output_checksum != scalar_stats.output_checksum) {
+        printf("\033[0;31mOutput changed when comparing chains against the snapshot!\033[0m\n");
+        return 1;
+    }
+#endif
+#if SEQUENCE_TRANSFORM_NO_MATCH_CACHE_SIZE > 0
+    printf("No-match cache hits: %ld of %ld lookups (%.1f%%)\n",
+           cache_hits, cache_lookups, cache_lookups ? 100.0 * cache_hits / cache_lookups : 0.0);
+    printf("Time without no-match cache: %.3fs (saved %.3fs)\n",
+           uncached_stats.elapsed, uncached_stats.elapsed - stats.elapsed);
+    if (stats.transforms != uncached_stats.transforms
+            || stats.output_checksum != uncached_stats.output_checksum) {
+        printf("\033[0;31mOutput changed when using the no-match cache!\033[0m\n");
+        return 1;
+    }
+#endif
+    return 0;
+}
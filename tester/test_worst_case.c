@@ -0,0 +1,73 @@
+// Copyright 2024 Guillaume Stordeur <guillaume.stordeur@gmail.com>
+// Copyright 2024 Matt Skalecki <ikcelaks@gmail.com>
+// Copyright 2024 QKekos <q.kekos.q@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+
+#include <stdlib.h>
+#include "st_defaults.h"
+#include "qmk_wrapper.h"
+#include "triecodes.h"
+#include "keybuffer.h"
+#include "key_stack.h"
+#include "trie.h"
+#include "sequence_transform.h"
+#include "tester.h"
+
+//////////////////////////////////////////////////////////////////////
+// Replays the key contexts written by the generator's --worst-case-file,
+// and checks the trie search for the last key of each doesn't do more
+// work than the generator's upper bounds.
+// Each line is: flash_reads node_visits branches_followed context
+int test_worst_case(const st_test_options_t *options)
+{
+    FILE *file = fopen(options->worst_case_file, "rb");
+    if (!file) {
+        printf("Unable to open %s\n", options->worst_case_file);
+        return 1;
+    }
+    st_key_buffer_t *buf = st_get_key_buffer();
+    st_cursor_t *cursor = st_get_cursor();
+#if SEQUENCE_TRANSFORM_HOST_SIMD
+    // snapshot compares read the trie without going through the counters
+    cursor->snapshot_disabled = true;
+#endif
+    int contexts = 0, fails = 0;
+    char line[1024];
+    while (fgets(line, sizeof(line), file)) {
+        line[strcspn(line, "\r\n")] = 0;
+        long bound_reads, bound_visits, bound_branches;
+        int context_start;
+        if (line[0] == '#' || sscanf(line, "%ld %ld %ld %n",
+                &bound_reads, &bound_visits, &bound_branches, &context_start) != 3) {
+            continue;
+        }
+        // keys are pushed as typed, without performing any action
+        buf->size = 0;
+        for (const char *c = line + context_start; *c; ++c) {
+            st_key_buffer_push(buf, st_keycode_to_triecode(st_test_ascii_to_keycode(*c), TEST_KC_SEQ_TOKEN_0));
+        }
+        st_trie_match_t match = {0, {0, 0, 0, 0}, false, 0, {0}};
+        st_cursor_init(cursor, 0, false);
+        st_trie_search_stats = (st_trie_search_stats_t){0, 0, 0};
+        st_find_longest_chain(cursor, &match, 0);
+        const st_trie_search_stats_t *measured = &st_trie_search_stats;
+        const bool fail = measured->data_reads > bound_reads
+            || measured->node_visits > bound_visits
+            || measured->branches_followed > bound_branches;
+        if (fail || options->print_all) {
+            printf("%s \"%s\": %ld/%ld bytes read, %ld/%ld nodes, %ld/%ld multi-branch entries\n",
+                fail ? "FAIL" : "OK  ", line + context_start,
+                measured->data_reads, bound_reads,
+                measured->node_visits, bound_visits,
+                measured->branches_followed, bound_branches);
+        }
+        ++contexts;
+        fails += fail;
+    }
+    fclose(file);
+#if SEQUENCE_TRANSFORM_HOST_SIMD
+    cursor->snapshot_disabled = false;
+#endif
+    printf("Worst case contexts replayed: %d, over the generator's bounds: %d\n", contexts, fails);
+    return fails > 0;
+}
@@ -14,9 +14,15 @@
 #include "keybuffer.h"
 #include "key_stack.h"
 #include "trie.h"
+#include "snapshot.h"
+#include "sequence_transform.h"
+#include "st_blob.h"
+#include "latency.h"
 #include "tester.h"
 #ifdef WIN32
 #include <windows.h>
+#else
+#include <unistd.h>
 #endif
 
 // Stack containing triecodes seen by tap_code16
@@ -26,11 +32,22 @@ st_key_stack_t sim_output = {
     256,
     0
 };
+uint32_t sim_output_checksum = 0;
+long sim_output_taps = 0;
+
+// Dictionary loaded with -b
+static st_blob_t blob;
+st_blob_t *loaded_blob = 0;
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+static st_storage_t blob_storage;
+#endif
 
 //////////////////////////////////////////////////////////////////
 static st_test_action_func_t actions[] = {
     [ACTION_TEST_ALL_RULES] = test_all_rules,
     [ACTION_TEST_ASCII_STRING] = test_ascii_string,
+    [ACTION_TEST_TEXT_FILE] = test_text_file,
+    [ACTION_TEST_WORST_CASE] = test_worst_case,
     0
 };
 
@@ -51,6 +68,8 @@ void sequence_transform_on_missed_rule_user(const st_trie_rule_t *rule)
 // (overriden function)
 void tap_code16(uint16_t keycode)
 {
+    sim_output_checksum = sim_output_checksum * 31 + keycode;
+    ++sim_output_taps;
     switch (keycode) {
         case KC_BSPC:
             if (sim_output.size > 0) {
@@ -65,20 +84,87 @@ void tap_code16(uint16_t keycode)
     }
 }
 //////////////////////////////////////////////////////////////////////
+// Switches the engine and test rules to the dictionary in a blob file
+// written by the generator, instead of the one compiled into the tester
+int load_blob(const char *path, bool paged)
+{
+    const char *error = st_blob_open(&blob, path);
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+    if (!error && paged) {
+        error = st_blob_attach_storage(&blob, &blob_storage, path);
+    }
+#else
+    if (!error && paged) {
+        error = "tester built without SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE";
+    }
+#endif
+    if (error) {
+        printf("Unable to load %s: %s\n", path, error);
+        return 1;
+    }
+    const int count = blob.stats[ST_BLOB_TEST_RULE_COUNT];
+    const uint8_t **sequences = malloc((count + 1) * sizeof(uint8_t *));
+    const uint8_t **transforms = malloc((count + 1) * sizeof(uint8_t *));
+    const uint8_t *rules = blob.sections[ST_BLOB_TEST_RULES];
+    const uint8_t *end = rules + blob.section_sizes[ST_BLOB_TEST_RULES];
+    for (int i = 0; i < count; ++i) {
+        // the test rules point into the mapped file
+        const uint8_t *transform = memchr(rules, 0, end - rules);
+        const uint8_t *next = transform ? memchr(transform + 1, 0, end - transform - 1) : 0;
+        if (!next) {
+            printf("Unable to load %s: invalid test rules\n", path);
+            return 1;
+        }
+        sequences[i] = rules;
+        transforms[i] = transform + 1;
+        rules = next + 1;
+    }
+    sequences[count] = transforms[count] = 0;
+    st_engine_t *engine = st_blob_create_engine(&blob);
+    if (!engine) {
+        printf("Unable to load %s: unable to allocate the engine\n", path);
+        free(sequences);
+        free(transforms);
+        return 1;
+    }
+    set_test_rules(sequences, transforms);
+    st_set_engine(engine);
+    loaded_blob = &blob;
+    return 0;
+}
+//////////////////////////////////////////////////////////////////////
 void print_help(void)
 {
     printf("Sequence Transform Tester usage:\n");
-    printf("tester [-p] [-t <tests>] [-s <test_bit_string>] [-d <feature>]\n");
+    printf("tester [-p] [-j <jobs>] [-b <blob_file> [-c]] [-t <tests>] [-s <test_bit_string>] [-f <text_file>] [-w <worst_case_file>] [-l] [-d <feature>]\n");
     puts("");
     printf("By default, all tests will be performed on all compiled rules.\n");
     printf("Only test failures and warnings will be shown.\n");
     puts("");
     printf("  -p print all tested rules\n");
     puts("");
+    printf("  -j split the rules between <jobs> worker processes.\n");
+    printf("     Defaults to the number of cores. Output is the same for any <jobs>.\n");
+    puts("");
+    printf("  -b load the rules from <blob_file> (sequence_transform_data.bin)\n");
+    printf("     instead of the ones compiled in, without rebuilding the tester.\n");
+    puts("");
+    printf("  -c read the trie and completions of <blob_file> through the page cache,\n");
+    printf("     with the file as a simulated block device (needs ST_STORAGE_PAGE_SIZE).\n");
+    puts("");
     printf("  -s run simulation of sequence transform of passed <test_string>,\n");
     printf("     one char at a time. Ascii sequence tokens and wordbreak symbol\n");
     printf("     can be used, as defined in your sequence_transform_config.json file.\n");
     puts("");
+    printf("  -f replay the contents of <text_file> through sequence transform,\n");
+    printf("     one char at a time, and print statistics about the run.\n");
+    puts("");
+    printf("  -w check the trie search work for each key context in <worst_case_file>\n");
+    printf("     (written by the generator's --worst-case-file) is within its bounds.\n");
+    puts("");
+    printf("  -l print histograms of how long st_perform, backspaces and trie searches\n");
+    printf("     took during the run (needs ST_LATENCY_HISTOGRAMS).\n");
+    puts("");
     printf("  -t each bit in <test_bit_string> turns a test on or off.\n");
     printf("     ex: -t \"101\" would only run tests #1 and #3.\n");
     printf("     Available tests:\n");
@@ -98,8 +184,19 @@ void init_options(int argc, char **argv, st_test_options_t *options)
     options->action = ACTION_TEST_ALL_RULES;
     options->tests = 0;
     options->user_str = 0;
+    options->text_file = 0;
+    options->worst_case_file = 0;
+    options->blob_file = 0;
+    options->paged = false;
     // default is to only print errors/warnings
     options->print_all = false;
+    options->latency = false;
+    // default is one worker per core
+#ifdef WIN32
+    options->jobs = 1;
+#else
+    options->jobs = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
     // get options from command line args
     for (int i = 1; i < argc; ++i) {
         if (!strcmp(argv[i], "-p")) {
@@ -107,10 +204,26 @@ void init_options(int argc, char **argv, st_test_options_t *options)
         } else if (!strcmp(argv[i], "-s") && i+1 < argc) {
             options->user_str = argv[i+1];
             options->action = ACTION_TEST_ASCII_STRING;
+        } else if (!strcmp(argv[i], "-f") && i+1 < argc) {
+            options->text_file = argv[i+1];
+            options->action = ACTION_TEST_TEXT_FILE;
+        } else if (!strcmp(argv[i], "-w") && i+1 < argc) {
+            options->worst_case_file = argv[i+1];
+            options->action = ACTION_TEST_WORST_CASE;
+        } else if (!strcmp(argv[i], "-b") && i+1 < argc) {
+            options->blob_file = argv[i+1];
+        } else if (!strcmp(argv[i], "-l")) {
+            options->latency = true;
+        } else if (!strcmp(argv[i], "-c")) {
+            options->paged = true;
+        } else if (!strcmp(argv[i], "-j") && i+1 < argc) {
+            options->jobs = atoi(argv[i+1]);
         } else if (!strcmp(argv[i], "-t") && i+1 < argc) {
             options->tests = argv[i+1];
         } else if (!strcmp(argv[i], "-d") && i+1 < argc) {
             st_debug_set_flag_str(argv[i+1]);
+            // debug output should show every key being replayed
+            sim_checkpoints_enabled = false;
         } else if (!strcmp(argv[i], "-h")) {
             print_help();
             exit(0);
@@ -126,5 +239,23 @@ int main(int argc, char **argv)
 #endif
     st_test_options_t options;
     init_options(argc, argv, &options);
-    return actions[options.action](&options);
+#if SEQUENCE_TRANSFORM_HOST_SIMD
+    const int triecode = st_snapshot_check_classes();
+    if (triecode >= 0) {
+        printf("Snapshot predicate classes of triecode 0x%02X differ from predicates.c\n", triecode);
+        return 1;
+    }
+#endif
+    if (options.blob_file && load_blob(options.blob_file, options.paged)) {
+        return 1;
+    }
+    const int res = actions[options.action](&options);
+    if (options.latency) {
+#if SEQUENCE_TRANSFORM_LATENCY_HISTOGRAMS
+        st_latency_dump();
+#else
+        printf("tester built without ST_LATENCY_HISTOGRAMS\n");
+#endif
+    }
+    return res;
 }
@@ -9,10 +9,20 @@ extern char missed_rule_seq[128];
 extern char missed_rule_transform[128];
 // Virtual output
 extern st_key_stack_t sim_output;
+// Running checksum of every key sent to the virtual output
+extern uint32_t sim_output_checksum;
+// Number of keys sent to the virtual output
+extern long sim_output_taps;
+// Replay rules from checkpoints of shared key presses (off when debugging)
+extern bool sim_checkpoints_enabled;
+// Dictionary loaded with -b, or 0 when using the compiled in one
+extern struct st_blob_t *loaded_blob;
 
 typedef enum {
     ACTION_TEST_ALL_RULES,
     ACTION_TEST_ASCII_STRING,
+    ACTION_TEST_TEXT_FILE,
+    ACTION_TEST_WORST_CASE,
 } st_test_action_t;
 
 typedef enum {
@@ -50,8 +60,14 @@ typedef struct {
 typedef struct {
     int     action;
     char    *user_str;
+    char    *text_file;
+    char    *worst_case_file;
+    char    *blob_file;
+    bool    paged;
     char    *tests;
     bool    print_all;
+    bool    latency;
+    int     jobs;
 } st_test_options_t;
 
 typedef int (*st_test_action_func_t)(const st_test_options_t *);
@@ -60,15 +76,21 @@ void    print_available_tests(void);
 
 //      Internal
 void    sim_st_perform(const uint8_t *sequence);
+void    sim_advance_time(uint32_t ms);
 
 //      Rule tests
 void    test_perform(const st_test_rule_t *rule, st_test_result_t *res);
 void    test_virtual_output(const st_test_rule_t *rule, st_test_result_t *res);
 void    test_cursor(const st_test_rule_t *rule, st_test_result_t *res);
 void    test_backspace(const st_test_rule_t *rule, st_test_result_t *res);
+void    test_undo(const st_test_rule_t *rule, st_test_result_t *res);
+void    test_backspace_repeat(const st_test_rule_t *rule, st_test_result_t *res);
 void    test_find_rule(const st_test_rule_t *rule, st_test_result_t *res);
 int     test_rule(const st_test_rule_t *rule, bool *tests, bool print_all, int *warns);
+void    set_test_rules(const uint8_t **sequences, const uint8_t **transforms);
 
 //      Test Actions
 int     test_all_rules(const st_test_options_t *options);
 int     test_ascii_string(const st_test_options_t *options);
+int     test_text_file(const st_test_options_t *options);
+int     test_worst_case(const st_test_options_t *options);
@@ -4,6 +4,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "qmk_wrapper.h"
+#include "st_debug.h"
 #include "tester_utils.h"
 #include "triecodes.h"
 
@@ -46,3 +47,74 @@ void st_triecodes_to_ascii_str(const uint8_t *triecodes, char *str)
     }
     *str = 0;
 }
+#if SEQUENCE_TRANSFORM_TRACE
+//////////////////////////////////////////////////////////////////
+static const char *predicate_names[] = {
+    "upper_alpha", "alpha", "digit", "terminating_punct",
+    "nonterminating_punct", "punct", "nonalpha", "any"
+};
+//////////////////////////////////////////////////////////////////
+// Prints a trace record as a debug line
+static void st_trace_print_record(const st_trace_record_t *r)
+{
+    switch (r->event) {
+        case ST_TRACE_NODE:
+            printf("Node Offset: %d (%d, %d): has_match %d, has_branch %d, %s %d, %s %d\n",
+                r->offset, r->index, r->sub_index, r->value >> 15, (r->value >> 14) & 1,
+                r->value >> 15 ? "has_unchained_match" : "is_multibranch", (r->value >> 13) & 1,
+                r->value >> 15 ? "chain_match_count" : "min_depth", r->value & 0x0FFF);
+            break;
+        case ST_TRACE_BRANCH:
+            printf(" B Offset: %d; Code: %#04X; Key: %#04X\n", r->offset, r->value, r->triecode);
+            break;
+        case ST_TRACE_MULTI_BRANCH:
+            printf(" Multi-B %sOffset: %d; Code: %#04X; Key: %#04X\n",
+                r->value >> 8 ? "MATCH " : "", r->offset, r->value & 0xFF, r->triecode);
+            break;
+        case ST_TRACE_CHAIN:
+            printf("Chaining Offset: %d; Code: %#04X; Key: %#04X\n", r->offset, r->value, r->triecode);
+            break;
+        case ST_TRACE_CHAIN_SNAPSHOT:
+            printf("Chaining Offset: %d; %d codes match snapshot\n", r->offset, r->value);
+            break;
+        case ST_TRACE_MATCH:
+            printf("New Match found: (%d, %d) %d\n", r->index, r->sub_index, r->value);
+            break;
+        case ST_TRACE_CHAINED_CHECK:
+            printf("Checking for sub-rule matching %#06X\n", r->value);
+            break;
+        case ST_TRACE_SUB_RULE:
+            printf("  sub-rule %#06X\n", r->value);
+            break;
+        case ST_TRACE_PRUNE:
+            printf("  Pruned: need %d symbols\n", r->value);
+            break;
+        case ST_TRACE_PREDICATE:
+            printf(" st_pred_%s: Res: %d; Code: %#04X\n",
+                predicate_names[(r->value & 0xFF) % 8], r->value >> 8, r->triecode);
+            break;
+        default:
+            printf("Unknown trace event %d\n", r->event);
+    }
+}
+#endif
+//////////////////////////////////////////////////////////////////
+// Prints the trace records written since the last call, if
+// sequence_match debug prints are on (all events are from the search)
+void st_trace_print_new(void)
+{
+#if SEQUENCE_TRANSFORM_TRACE
+    static uint32_t printed = 0;
+    const uint32_t count = st_trace.count;
+    if (st_debug_check(ST_DBG_SEQ_MATCH)) {
+        if (count - printed > SEQUENCE_TRANSFORM_TRACE_SIZE) {
+            printf("(%u trace records lost)\n", count - printed - SEQUENCE_TRANSFORM_TRACE_SIZE);
+            printed = count - SEQUENCE_TRANSFORM_TRACE_SIZE;
+        }
+        for (; printed != count; ++printed) {
+            st_trace_print_record(&st_trace.records[printed % SEQUENCE_TRANSFORM_TRACE_SIZE]);
+        }
+    }
+    printed = count;
+#endif
+}
@@ -7,4 +7,4 @@
 void    st_triecodes_to_utf8_str(const uint8_t *triecodes, char *str);
 void    st_triecodes_transform_to_utf8_str(const uint8_t *triecodes, char *str);
 void    st_triecodes_to_ascii_str(const uint8_t *triecodes, char *str);
-
+void    st_trace_print_new(void);
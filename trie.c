@@ -12,14 +12,33 @@
 #include "key_stack.h"
 #include "trie.h"
 #include "cursor.h"
+#include "completions.h"
+#include "snapshot.h"
+#include "latency.h"
+#include "utils.h"
 
+#if !defined(ST_TESTER) && !defined(ST_HOST)
+// only for TRIE_PAYLOAD_INDEX_SIZE; other builds read it from the trie
+#include "sequence_transform_data.h"
+#endif
+
+// Records a search event at the cursor's position
+#define trace_search(event, offset, triecode, value) \
+    st_trace(ST_DBG_SEQ_MATCH, event, offset, cursor->pos.index, cursor->pos.sub_index, triecode, value)
+
+#ifdef ST_TESTER
+st_trie_search_stats_t st_trie_search_stats = {0, 0, 0};
+#endif
 //////////////////////////////////////////////////////////////////////
 uint8_t st_get_trie_data_byte(const st_trie_t *trie, int index)
 {
     st_assert(0 <= index && index < trie->data_size,
         "Tried reading outside trie data! index: %d, size: %d",
         index, trie->data_size);
-    return pgm_read_byte(&trie->data[index]);
+#ifdef ST_TESTER
+    ++st_trie_search_stats.data_reads;
+#endif
+    return TRIE_READ_BYTE(trie, index);
 }
 //////////////////////////////////////////////////////////////////////
 uint16_t st_get_trie_data_word(const st_trie_t *trie, int index)
@@ -27,7 +46,11 @@ uint16_t st_get_trie_data_word(const st_trie_t *trie, int index)
     st_assert(0 <= index && index + 1 < trie->data_size,
         "Tried reading outside trie data! index: %d, size: %d",
         index, trie->data_size);
-    return (pgm_read_byte(&trie->data[index]) << 8) + pgm_read_byte(&trie->data[index + 1]);
+    st_assert(TRIE_ALIGN(index) == index, "Unaligned trie word! index: %d", index);
+#ifdef ST_TESTER
+    st_trie_search_stats.data_reads += 2;
+#endif
+    return TRIE_READ_WORD(trie, index);
 }
 //////////////////////////////////////////////////////////////////////
 uint8_t st_get_trie_completion_byte(const st_trie_t *trie, int index)
@@ -35,13 +58,96 @@ uint8_t st_get_trie_completion_byte(const st_trie_t *trie, int index)
     st_assert(0 <= index && index < trie->completions_size,
         "Tried reading outside completion data! index: %d, size: %d",
         index, trie->completions_size);
+    return COMPLETIONS_READ_BYTE(trie, index);
+}
+//////////////////////////////////////////////////////////////////////
+uint8_t st_get_trie_payload_byte(const st_trie_t *trie, int index)
+{
+    st_assert(0 <= index && index < trie->payloads_size,
+        "Tried reading outside payload data! index: %d, size: %d",
+        index, trie->payloads_size);
+    return PAYLOADS_READ_BYTE(trie, index);
+}
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+//////////////////////////////////////////////////////////////////////
+uint8_t st_trie_read_byte(const st_trie_t *trie, int index)
+{
+    if (trie->storage) {
+        return st_storage_read_byte(trie->storage, trie->data_address + index);
+    }
+    return pgm_read_byte(&trie->data[index]);
+}
+//////////////////////////////////////////////////////////////////////
+uint8_t st_trie_read_completion_byte(const st_trie_t *trie, int index)
+{
+    if (trie->storage) {
+        return st_storage_read_byte(trie->storage, trie->completions_address + index);
+    }
     return pgm_read_byte(&trie->completions[index]);
 }
+//////////////////////////////////////////////////////////////////////
+uint8_t st_trie_read_payload_byte(const st_trie_t *trie, int index)
+{
+    if (trie->storage) {
+        return st_storage_read_byte(trie->storage, trie->payloads_address + index);
+    }
+    return pgm_read_byte(&trie->payloads[index]);
+}
+//////////////////////////////////////////////////////////////////////
+// Pins the page of the root node, then the pages of its children,
+// which every search goes through. Returns the number of pages pinned.
+int st_trie_pin_top_level(const st_trie_t *trie)
+{
+    st_storage_t *storage = trie->storage;
+    if (!storage || !st_storage_pin(storage, trie->data_address)) {
+        return storage ? storage->pinned_count : 0;
+    }
+    uint16_t offset = 0;
+    st_trie_node_info_t node_info;
+    st_get_node_info(trie, &node_info, &offset);
+    if (node_info.has_branch && !node_info.has_match) {
+        for (; TDATA(trie, offset); offset += TRIE_BRANCH_ENTRY_SIZE) {
+            const uint16_t child_offset = TDATAW(trie, offset + TRIE_BRANCH_LINK_OFFSET);
+            if (!st_storage_pin(storage, trie->data_address + child_offset)) {
+                break;
+            }
+        }
+    }
+    return storage->pinned_count;
+}
+#endif
+//////////////////////////////////////////////////////////////////
+// Returns false if the most recent keys can't end any sequence,
+// using the (optional) trigger tables built by the generator
+bool st_trie_can_trigger(const st_trie_t *trie, const st_key_buffer_t *buf)
+{
+    // The pair table only applies when the previous key is read as input,
+    // which isn't the case if it performed an action
+    const st_key_action_t *prev = st_key_buffer_get(buf, 1);
+    const uint8_t prev_triecode = prev && prev->action_taken == ST_DEFAULT_KEY_ACTION ? prev->triecode : 0;
+    return st_trie_can_trigger_keys(trie, st_key_buffer_get_triecode(buf, 0), prev_triecode);
+}
+//////////////////////////////////////////////////////////////////
+// Same check, for callers that already know the most recent keys.
+// prev_triecode is 0 if the previous key isn't read as input.
+bool st_trie_can_trigger_keys(const st_trie_t *trie, uint8_t triecode, uint8_t prev_triecode)
+{
+    if (trie->trigger_keys && !PGM_LOADBIT(trie->trigger_keys, triecode)) {
+        return false;
+    }
+    if (trie->trigger_pair_index && prev_triecode) {
+        const uint8_t row = pgm_read_byte(&trie->trigger_pair_index[triecode]);
+        if (!PGM_LOADBIT(&trie->trigger_pair_rows[row * 32], prev_triecode)) {
+            return false;
+        }
+    }
+    return true;
+}
 //////////////////////////////////////////////////////////////////
 bool st_trie_get_completion(st_cursor_t *cursor, st_trie_search_result_t *res)
 {
     st_cursor_init(cursor, 0, false);
-    st_log_time(st_find_longest_chain(cursor, &res->trie_match, 0));
+    st_log_time(ST_LATENCY_TRIE_SEARCH, st_find_longest_chain(cursor, &res->trie_match, 0));
     if (res->trie_match.seq_match_pos.segment_len > 0) {
         st_get_payload_from_match_index(cursor->trie, &res->trie_payload, res->trie_match.trie_match_index);
         st_debug(ST_DBG_SEQ_MATCH, "completion search res: index: %d, len: %d, bspaces: %d, func: %d\n",
@@ -54,14 +160,29 @@ bool st_trie_get_completion(st_cursor_t *cursor, st_trie_search_result_t *res)
     return false;
 }
 //////////////////////////////////////////////////////////////////
+// match_index is the offset of the match in the trie data. It holds
+// the payload, or its index in the deduplicated payload table.
+// Rules with the same action share a payload, but not a match index.
 void st_get_payload_from_match_index(const st_trie_t *trie,
                                      st_trie_payload_t *payload,
                                      uint16_t match_index)
 {
+    if (!TRIE_INDEX_SIZE(trie)) {
+        st_get_payload_from_code(payload,
+            TDATA(trie, match_index),
+            TDATA(trie, match_index+1),
+            TDATAW(trie, match_index+2));
+        return;
+    }
+    const int payload_index = TRIE_INDEX_SIZE(trie) == 1
+        ? TDATA(trie, match_index)
+        : TDATAW(trie, match_index);
+    const int entry = payload_index * TRIE_PAYLOAD_SIZE;
+    st_assert(entry < trie->payloads_size, "Invalid payload index: %d", payload_index);
     st_get_payload_from_code(payload,
-        TDATA(trie, match_index),
-        TDATA(trie, match_index+1),
-        TDATAW(trie, match_index+2));
+        PDATA(trie, entry),
+        PDATA(trie, entry+1),
+        (PDATA(trie, entry+2) << 8) + PDATA(trie, entry+3));
 }
 //////////////////////////////////////////////////////////////////
 void st_get_payload_from_code(st_trie_payload_t *payload, uint8_t code_byte1, uint8_t code_byte2, uint16_t completion_index)
@@ -78,24 +199,54 @@ void st_get_payload_from_code(st_trie_payload_t *payload, uint8_t code_byte1, ui
 void st_get_node_info(const st_trie_t *trie, st_trie_node_info_t *node_info, uint16_t *offset)
 {
     // node info is bit-backed into one or two bytes:
-    // (N: node type, F: func, B: backspaces, C: completion length)
+    // (N: node type, M: unchained match, C: chain check count, D: min depth)
     // if chain_check_count is less than 16, it will be one byte
     // 0b NNM0 CCCC
     // if chain_check_count is 16 or greater, it will be two bytes
     // 0b NNM1 CCCC CCCC CCCC
+    // branch and chain nodes use the 5th bit to flag a min depth byte
+    // 0b NNM1 0000 DDDD DDDD
     const uint8_t byte1 = TDATA(trie, (*offset)++);
-    st_debug(ST_DBG_SEQ_MATCH, "Node Info %#04X (%#04X): ", *offset-1, byte1);
     node_info->has_match = byte1 & TRIE_MATCH_BIT;
     node_info->has_branch = byte1 & TRIE_BRANCH_BIT;
     node_info->has_unchained_match = byte1 & TRIE_UNCHAINED_MATCH_BIT;
     node_info->chain_check_count = byte1 & TRIE_CHAIN_CHECK_COUNT_MASK;
+    node_info->min_depth = 0;
     if (byte1 & TRIE_EXTENDED_HEADER_BIT) {
-        node_info->chain_check_count = (node_info->chain_check_count << 8) + TDATA(trie, (*offset)++);
+        if (node_info->has_match) {
+            node_info->chain_check_count = (node_info->chain_check_count << 8) + TDATA(trie, (*offset)++);
+        } else {
+            node_info->min_depth = TDATA(trie, (*offset)++);
+        }
+    }
+    if (node_info->has_match || node_info->has_branch) {
+        // match data and branch links may be padded to be word aligned
+        *offset = TRIE_ALIGN(*offset);
     }
-    st_debug(ST_DBG_SEQ_MATCH, "has_match %d, has_branch %d, has_unchained_match %d, chain_match_count %d\n",
-                    node_info->has_match, node_info->has_branch, node_info->has_unchained_match, node_info->chain_check_count);
 }
 
+//////////////////////////////////////////////////////////////////////
+// Records the symbol the search is about to move the cursor past
+static inline void capture_symbol(st_cursor_t *cursor, uint8_t triecode)
+{
+    const int pos = cursor->pos.segment_len - 1;
+    if (pos < ST_SEQ_CAPTURE_SIZE) {
+        cursor->seq_path[pos] = triecode;
+    }
+}
+//////////////////////////////////////////////////////////////////////
+// Records a match at the cursor position, with the symbols read to reach it
+static void record_match(st_cursor_t *cursor, st_trie_match_t *match, uint16_t match_index)
+{
+    match->trie_match_index = match_index;
+    match->seq_match_pos = st_cursor_save(cursor);
+    // the cursor doesn't move past the end, so it may still be at the last symbol read
+    const int count = MIN(cursor->pos.segment_len - !st_cursor_at_end(cursor), ST_SEQ_CAPTURE_SIZE);
+    for (int i = 0; i < count; ++i) {
+        match->seq_symbols[i] = cursor->seq_path[i];
+    }
+    match->seq_symbol_count = count;
+}
 //////////////////////////////////////////////////////////////////////
 bool find_branch_offset(const st_trie_t *trie, st_cursor_t * cursor, uint16_t *offset)
 {
@@ -103,59 +254,128 @@ bool find_branch_offset(const st_trie_t *trie, st_cursor_t * cursor, uint16_t *o
     if (!key_triecode) {
         return false;
     }
-    for (uint8_t code = TDATA(trie, *offset); code; *offset += 3, code = TDATA(trie, *offset)) {
-        st_debug(ST_DBG_SEQ_MATCH, " B Offset: %d; Code: %#04X; Key: %#04X\n", *offset, code, key_triecode);
+    for (uint8_t code = TDATA(trie, *offset); code; *offset += TRIE_BRANCH_ENTRY_SIZE, code = TDATA(trie, *offset)) {
+        trace_search(ST_TRACE_BRANCH, *offset, key_triecode, code);
         if (code == key_triecode) {
             // 16bit offset to child node is built from next uint16_t
-            *offset = st_get_trie_data_word(trie, *offset + 1);
+            *offset = st_get_trie_data_word(trie, *offset + TRIE_BRANCH_LINK_OFFSET);
+            capture_symbol(cursor, key_triecode);
             return true;
         }
     }
     return false;
 }
 //////////////////////////////////////////////////////////////////////
-bool follow_multi_branches(const st_trie_t *trie, st_cursor_t *cursor, st_trie_match_t *longest_match, uint16_t offset)
+bool find_chained_match(const st_cursor_t *cursor, uint16_t *offset, int count, uint16_t match_index)
 {
-    st_trie_match_type_t match_type = ST_NO_MATCH;
-    uint8_t key_triecode = st_cursor_get_triecode(cursor);
-    if (!key_triecode) {
+    const st_trie_t *trie = cursor->trie;
+    // Chained matches are sorted by sub-rule match index, so binary search them
+    // Each entry is the sub-rule match index (2 bytes) then the match data
+    int lo = 0, hi = count - 1;
+    while (lo <= hi) {
+        const int mid = (lo + hi) / 2;
+        const uint16_t entry_offset = *offset + mid * TRIE_CHAINED_MATCH_SIZE(trie);
+        const uint16_t sub_rule_match_index = st_get_trie_data_word(trie, entry_offset);
+        trace_search(ST_TRACE_SUB_RULE, entry_offset, 0, sub_rule_match_index);
+        if (match_index == sub_rule_match_index) {
+            // The match index is right after the sub-rule link
+            *offset = entry_offset + 2;
+            return true;
+        }
+        if (match_index < sub_rule_match_index) {
+            hi = mid - 1;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return false;
+}
+#if SEQUENCE_TRANSFORM_HOST_SIMD
+//////////////////////////////////////////////////////////////////////
+// Chains can be compared against a snapshot of the key buffer
+// while the cursor reads keys as typed, straight from trie memory
+static bool use_snapshot(const st_cursor_t *cursor)
+{
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+    if (cursor->trie->storage) {
         return false;
     }
-    st_cursor_next(cursor);
-    st_cursor_pos_t pos = st_cursor_save(cursor);
-    for (uint8_t code = TDATA(trie, offset); code; offset += 3, code = TDATA(trie, offset)) {
-        st_debug(ST_DBG_SEQ_MATCH, " Multi-B Offset: %d; Code: %#04X; Key: %#04X\n", offset, code, key_triecode);
-        if (st_match_triecode(code, key_triecode)) {
-            // 16bit offset to child node is built from next uint16_t
-            st_debug(ST_DBG_SEQ_MATCH, " Multi-B MATCH Offset: %d; Code: %#04X; Key: %#04X\n", offset, code, key_triecode);
-            const uint16_t child_offset = st_get_trie_data_word(trie, offset + 1);
-            match_type = st_find_longest_chain(cursor, longest_match, child_offset);
-            if (match_type == ST_FINAL_MATCH) {
-                return ST_FINAL_MATCH;
+#endif
+#ifdef ST_TESTER
+    if (cursor->snapshot_disabled) {
+        return false;
+    }
+#endif
+    return !cursor->pos.as_output;
+}
+#endif
+//////////////////////////////////////////////////////////////////////
+// Moves the search to the next entry of the innermost pending multi-branch
+// that matches its key, dropping multi-branches that have none left.
+// Returns false once all of them are exhausted.
+static bool next_multi_branch(st_cursor_t *cursor, int *depth, uint16_t *offset)
+{
+    const st_trie_t *trie = cursor->trie;
+    while (*depth > 0) {
+        st_trie_branch_t *branch = &cursor->branch_stack[*depth - 1];
+        for (uint8_t code = TDATA(trie, branch->offset); code; code = TDATA(trie, branch->offset)) {
+            const uint16_t entry_offset = branch->offset;
+            branch->offset += TRIE_BRANCH_ENTRY_SIZE;
+            const bool match = st_match_triecode(code, branch->triecode);
+            trace_search(ST_TRACE_MULTI_BRANCH, entry_offset, branch->triecode, code + (match << 8));
+            if (match) {
+                // 16bit offset to child node is built from next uint16_t
+                *offset = st_get_trie_data_word(trie, entry_offset + TRIE_BRANCH_LINK_OFFSET);
+                st_cursor_restore(cursor, &branch->pos);
+#ifdef ST_TESTER
+                ++st_trie_search_stats.branches_followed;
+#endif
+                return true;
             }
-            st_cursor_restore(cursor, &pos);
         }
+        --*depth;
     }
-    return match_type;
+    return false;
 }
 
 /**
- * @brief Find longest chain in trie matching the key_buffer. (recursive)
+ * @brief Find longest chain in trie matching the key_buffer.
+ *
+ * A key can match several entries of a multi-branch node. The entries
+ * left to try are kept on cursor->branch_stack, which holds one entry per
+ * multi-branch on the current path (at most TRIE_MULTI_BRANCH_MAX_DEPTH).
+ * They are searched depth first, like a recursive search would.
  *
- * @param trie   trie_t struct containing trie data/size
- * @param res    result containing payload for longest sequence match
- * @param offset current offset in trie data
- * @param depth  current depth in trie
- * @return       true if match found
+ * @param cursor        cursor over the key buffer, with the trie to search
+ * @param longest_match filled with the longest match found
+ * @param offset        offset in trie data to start searching from
+ * @return              ST_FINAL_MATCH if a chained rule matched,
+ *                      ST_MATCH if another rule matched
  */
 st_trie_match_type_t st_find_longest_chain(st_cursor_t *cursor, st_trie_match_t *longest_match, uint16_t offset)
 {
     const st_trie_t *trie = cursor->trie;
     st_trie_match_type_t match_type = ST_NO_MATCH;
+    int depth = 0;
+#if SEQUENCE_TRANSFORM_HOST_SIMD
+    // taken when the first chain node is reached
+    st_snapshot_t snapshot;
+    snapshot.size = -1;
+#endif
     do {
-        st_assert(TDATA(trie, offset), "Unexpected null code! Offset: %d", offset);
+        // (read directly, so it doesn't count as a search read)
+        st_assert(TRIE_READ_BYTE(trie, offset), "Unexpected null code! Offset: %d", offset);
         st_trie_node_info_t node_info;
+        const uint16_t node_offset = offset;
         st_get_node_info(trie, &node_info, &offset);
+        trace_search(ST_TRACE_NODE, node_offset, 0,
+            (node_info.has_match << 15) | (node_info.has_branch << 14) | (node_info.has_unchained_match << 13)
+            | node_info.chain_check_count | node_info.min_depth);
+#ifdef ST_TESTER
+        ++st_trie_search_stats.node_visits;
+#endif
+        // set when the current path can't match anything more
+        bool dead_end = false;
 
         uint16_t match_index = st_cursor_get_matched_rule(cursor);
         if (match_index != ST_DEFAULT_KEY_ACTION) {
@@ -167,83 +387,108 @@ st_trie_match_type_t st_find_longest_chain(st_cursor_t *cursor, st_trie_match_t
         // Match Node if bit 15 is set
         if (node_info.has_match) {
             if (node_info.has_unchained_match) {
-                st_debug(ST_DBG_SEQ_MATCH, "New Match found: (%d, %d) %d\n",
-                    cursor->pos.index, cursor->pos.sub_index, cursor->pos.segment_len);
-                st_debug(ST_DBG_SEQ_MATCH, "Previous Match: (%d, %d) %d\n",
-                    longest_match->seq_match_pos.index, longest_match->seq_match_pos.sub_index, longest_match->seq_match_pos.segment_len);
+                trace_search(ST_TRACE_MATCH, offset, 0, cursor->pos.segment_len);
                 // record this if it is the longest match
                 if (st_cursor_longer_than(cursor, &longest_match->seq_match_pos)) {
                     match_type = ST_MATCH;
-                    longest_match->trie_match_index = offset;
-                    longest_match->seq_match_pos = st_cursor_save(cursor);
+                    record_match(cursor, longest_match, offset);
                 }
-                offset += TRIE_MATCH_SIZE;
+                offset += TRIE_MATCH_SIZE(trie);
             }
-            if (match_index != ST_DEFAULT_KEY_ACTION) {
-                if (node_info.chain_check_count > 0) {
-                    st_debug(ST_DBG_SEQ_MATCH, "Checking for sub-rule matching %#06X\n", match_index);
-                    for (int i = 0; i < node_info.chain_check_count; i++) {
-                        const uint16_t sub_rule_match_index = st_get_trie_data_word(trie, offset);
-                        st_debug(ST_DBG_SEQ_MATCH, "  sub-rule %#06X\n", sub_rule_match_index);
-                        if (match_index == sub_rule_match_index) {
-                            // This sub-rule was previously matched. This chained rule
-                            // must be the longest match, so we record it and return immediately
-                            // The match index is at offset + 2
-                            // (sub-rule-byte1 sub-rule-byte2 match-byte1 match-byte2 match-byte3 match-byte4)
-                            longest_match->trie_match_index = offset + 2;
-                            longest_match->seq_match_pos = st_cursor_save(cursor);
-                            longest_match->is_chained_match = true;
-                            return ST_FINAL_MATCH;
-                        }
-                        offset += TRIE_CHAINED_MATCH_SIZE;
-                    }
+            if (match_index != ST_DEFAULT_KEY_ACTION && node_info.chain_check_count > 0) {
+                trace_search(ST_TRACE_CHAINED_CHECK, offset, 0, match_index);
+                uint16_t chain_offset = offset;
+                if (find_chained_match(cursor, &chain_offset, node_info.chain_check_count, match_index)) {
+                    // This sub-rule was previously matched. This chained rule
+                    // must be the longest match, so we record it and return immediately
+                    record_match(cursor, longest_match, chain_offset);
+                    longest_match->is_chained_match = true;
+                    return ST_FINAL_MATCH;
                 }
-            } else {
-                // The currently focused key was not a match, so no sub-rule couled possibly match
-                // Skip over all the chain rule checks (each is 6 bytes long)
-                offset += TRIE_CHAINED_MATCH_SIZE * node_info.chain_check_count;
             }
-            // If bit 14 is also set, there is a child node after the completion string
-            if (node_info.has_branch) {
-                // move offset to next child node and continue walking the trie
-                // offset += 4;
-                st_debug(ST_DBG_SEQ_MATCH, "  Looking for more: offset %d; code %d\n",
-                    offset, TDATA(trie, offset));
-            } else {
-                // No more matches; return
-                return match_type;
+            // Skip over all the chain rule checks
+            offset += TRIE_CHAINED_MATCH_SIZE(trie) * node_info.chain_check_count;
+            // If bit 14 is also set, there is a child node after the completion string,
+            // and offset is now at that node so we continue walking the trie
+            if (!node_info.has_branch) {
+                // No more matches on this path
+                dead_end = true;
             }
+        } else if (node_info.min_depth && !st_cursor_can_supply(cursor, node_info.min_depth)) {
+            // Not enough symbols left in the buffer to reach any match in this subtree
+            trace_search(ST_TRACE_PRUNE, node_offset, 0, node_info.min_depth);
+            dead_end = true;
         } else if (node_info.has_branch) {
             // Branch Node (with multiple children) if bit 14 is set
-            // st_debug(ST_DBG_SEQ_MATCH, "Branching Offset: %d; Code: %#04X", offset, code);
-            // code = TDATA(trie, ++offset);
             // Find child key that matches the search buffer at the current depth
             if (node_info.is_multibranch) {
-                // It is possible for a key to match multiple branches, so we recursively
-                // follow all matches
-                return follow_multi_branches(trie, cursor, longest_match, offset) || match_type;
-            }
-            if (!find_branch_offset(trie, cursor, &offset)) {
-                // Couldn't go deeper; return.
-                return match_type;
+                // It is possible for a key to match multiple branches, so we
+                // push the branch and follow each matching entry in turn
+                const uint8_t key_triecode = st_cursor_get_triecode(cursor);
+                st_assert(!key_triecode || depth < cursor->branch_stack_size,
+                    "Multi-branch nesting exceeds TRIE_MULTI_BRANCH_MAX_DEPTH (%d)", cursor->branch_stack_size);
+                if (key_triecode && depth < cursor->branch_stack_size) {
+                    capture_symbol(cursor, key_triecode);
+                    st_cursor_next(cursor);
+                    st_trie_branch_t *branch = &cursor->branch_stack[depth++];
+                    branch->offset = offset;
+                    branch->triecode = key_triecode;
+                    branch->pos = st_cursor_save(cursor);
+#ifdef ST_TESTER
+                    if (depth > cursor->branch_stack_max) {
+                        cursor->branch_stack_max = depth;
+                    }
+#endif
+                }
+                dead_end = true;
+            } else if (find_branch_offset(trie, cursor, &offset)) {
+                st_cursor_next(cursor);
+            } else {
+                // Couldn't go deeper
+                dead_end = true;
             }
-            st_cursor_next(cursor);
         } else {
             // No high bits set, so this is a chain node
             // Travel down chain until we reach a zero byte, or we no longer match our buffer
-            uint8_t key_triecode;
+            uint8_t key_triecode = 0;
             uint8_t code;
+#if SEQUENCE_TRANSFORM_HOST_SIMD
+            if (use_snapshot(cursor)) {
+                if (snapshot.size < 0) {
+                    st_snapshot_take(&snapshot, cursor->buffer, trie->sequence_max_len);
+                }
+                // Skip the codes that match the snapshot in one compare. The loop
+                // below then reads the code that ends the chain or doesn't match.
+                const int count = st_snapshot_match_chain(&snapshot, cursor->pos.index,
+                    &trie->data[offset], trie->data_size - offset);
+                trace_search(ST_TRACE_CHAIN_SNAPSHOT, offset, 0, count);
+                for (int i = 0; i < count; ++i) {
+                    key_triecode = snapshot.triecodes[cursor->pos.index];
+                    capture_symbol(cursor, key_triecode);
+                    ++offset;
+                    if (!st_cursor_next(cursor)) {
+                        break;
+                    }
+                }
+            }
+#endif
             while ((code = TDATA(trie, offset++)) && (key_triecode = st_cursor_get_triecode(cursor))) {
-                st_debug(ST_DBG_SEQ_MATCH, "Chaining Offset: %d; Code: %#04X; Key: %#04X\n", offset, code, key_triecode);
-                if (!key_triecode || !st_match_triecode(code, key_triecode))
-                    return match_type;
+                trace_search(ST_TRACE_CHAIN, offset - 1, key_triecode, code);
+                if (!st_match_triecode(code, key_triecode)) {
+                    dead_end = true;
+                    break;
+                }
+                capture_symbol(cursor, key_triecode);
                 st_cursor_next(cursor);
             }
             if (!key_triecode) {
-                return match_type;
+                dead_end = true;
             }
             // After a chain, there should be a match or branch
         }
+        if (dead_end && !next_multi_branch(cursor, &depth, &offset)) {
+            return match_type;
+        }
     } while (true);
 }
 //////////////////////////////////////////////////////////////////////
@@ -251,9 +496,6 @@ void st_completion_to_str(const st_trie_t *trie,
                           const st_trie_payload_t *payload,
                           uint8_t *str)
 {
-    const uint16_t completion_end = payload->completion_index + payload->completion_len;
-    for (uint16_t i = payload->completion_index; i < completion_end; ++i) {
-        *str++ = CDATA(trie, i);
-    }
-    *str = '\0';
+    st_completion_decode(trie, payload->completion_index, payload->completion_len, str);
+    str[payload->completion_len] = '\0';
 }
@@ -4,26 +4,75 @@
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
+#include "st_defaults.h"
+#include "storage.h"
+
 //////////////////////////////////////////////////////////////////
 // Public API
 
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+#   define TRIE_READ_BYTE(trie, L)          st_trie_read_byte(trie, L)
+#   define COMPLETIONS_READ_BYTE(trie, L)   st_trie_read_completion_byte(trie, L)
+#   define PAYLOADS_READ_BYTE(trie, L)      st_trie_read_payload_byte(trie, L)
+#else
+#   define TRIE_READ_BYTE(trie, L)          pgm_read_byte(&trie->data[L])
+#   define COMPLETIONS_READ_BYTE(trie, L)   pgm_read_byte(&trie->completions[L])
+#   define PAYLOADS_READ_BYTE(trie, L)      pgm_read_byte(&trie->payloads[L])
+#endif
+
+#if SEQUENCE_TRANSFORM_TRIE_ALIGNED
+#   if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+#       define TRIE_READ_WORD(trie, L)  (TRIE_READ_BYTE(trie, L) + (TRIE_READ_BYTE(trie, (L) + 1) << 8))
+#   else
+#       define TRIE_READ_WORD(trie, L)  pgm_read_word(&trie->data[L])
+#   endif
+#   define TRIE_ALIGN(L)            (((L) + 1) & ~1)
+#   define TRIE_BRANCH_ENTRY_SIZE   4
+#   define TRIE_BRANCH_LINK_OFFSET  2
+#else
+#   define TRIE_READ_WORD(trie, L)  ((TRIE_READ_BYTE(trie, L) << 8) + TRIE_READ_BYTE(trie, (L) + 1))
+#   define TRIE_ALIGN(L)            (L)
+#   define TRIE_BRANCH_ENTRY_SIZE   3
+#   define TRIE_BRANCH_LINK_OFFSET  1
+#endif
+
 #ifdef ST_TESTER
 #   define TDATAW(trie, L) st_get_trie_data_word(trie, L)
 #   define TDATA(trie, L)  st_get_trie_data_byte(trie, L)
 #   define CDATA(trie, L)  st_get_trie_completion_byte(trie, L)
+#   define PDATA(trie, L)  st_get_trie_payload_byte(trie, L)
 #else
-#   define TDATAW(trie, L) ((pgm_read_byte(&trie->data[L]) << 8) + pgm_read_byte(&trie->data[L + 1]))
-#   define TDATA(trie, L)  pgm_read_byte(&trie->data[L])
-#   define CDATA(trie, L)  pgm_read_byte(&trie->completions[L])
+#   define TDATAW(trie, L) TRIE_READ_WORD(trie, L)
+#   define TDATA(trie, L)  TRIE_READ_BYTE(trie, L)
+#   define CDATA(trie, L)  COMPLETIONS_READ_BYTE(trie, L)
+#   define PDATA(trie, L)  PAYLOADS_READ_BYTE(trie, L)
 #endif
 
 #define TRIE_MATCH_BIT              0x80
 #define TRIE_BRANCH_BIT             0x40
 #define TRIE_UNCHAINED_MATCH_BIT    0x20
 #define TRIE_EXTENDED_HEADER_BIT    0x10
+#define TRIE_MIN_DEPTH_BIT          0x10    // on branch and chain nodes only
 #define TRIE_CHAIN_CHECK_COUNT_MASK 0x0F
-#define TRIE_MATCH_SIZE             4
-#define TRIE_CHAINED_MATCH_SIZE     6
+#define TRIE_PAYLOAD_SIZE           4
+// Bytes of a payload index (0 if payloads are in the trie data).
+// Fixed by the generator for the compiled trie; blobs loaded by
+// the tester and host library can use either layout.
+#if defined(ST_TESTER) || defined(ST_HOST)
+#   define TRIE_INDEX_SIZE(trie)    ((trie)->payload_index_size)
+#else
+#   define TRIE_INDEX_SIZE(trie)    TRIE_PAYLOAD_INDEX_SIZE
+#endif
+// Matches hold their payload, or its index in trie_t.payloads if the
+// generator deduplicated them. Chained matches are a sub-rule link
+// followed by the same data.
+#define TRIE_MATCH_SIZE(trie) \
+    (TRIE_INDEX_SIZE(trie) ? TRIE_ALIGN(TRIE_INDEX_SIZE(trie)) : TRIE_PAYLOAD_SIZE)
+#define TRIE_CHAINED_MATCH_SIZE(trie)   (2 + TRIE_MATCH_SIZE(trie))
+
+// Symbols of a match kept for resolving seq refs (◯⑴⑵...)
+// without walking the cursor back
+#define ST_SEQ_CAPTURE_SIZE         8
 
 typedef enum {
     ST_NO_MATCH = 0,
@@ -48,6 +97,7 @@ typedef struct
         bool is_multibranch;        // true if the branch contains metacharacters
     };
     int  chain_check_count;     // number chained rules that can match here
+    int  min_depth;             // min symbols needed to reach a match (0 if unknown)
 } st_trie_node_info_t;
 
 typedef struct
@@ -62,20 +112,59 @@ typedef struct
 {
     int            data_size;          // size in words of data buffer
     const uint8_t  *data;              // serialized trie node data
+    int            payloads_size;      // size in bytes of payloads buffer
+    const uint8_t  *payloads;          // unique match payloads, TRIE_PAYLOAD_SIZE bytes each
+#if defined(ST_TESTER) || defined(ST_HOST)
+    int            payload_index_size; // see TRIE_INDEX_SIZE
+#endif
     int            completions_size;   // size in bytes of completions data buffer
     const uint8_t  *completions;       // packed completions strings buffer
+#if SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS
+    const uint8_t  *completion_code_counts;     // number of codes of each length
+    int            completion_code_max_len;     // size of completion_code_counts
+    const uint8_t  *completion_code_symbols;    // triecodes in canonical code order
+    const uint32_t *completion_checkpoints;     // bit index of every 16th completion triecode
+    int            completion_checkpoint_count;
+#endif
+    int            sequence_max_len;   // max len of all sequences
     int            completion_max_len; // max len of all completion strings
     int            max_backspaces;     // max backspaces for all completions
+    const uint8_t  *trigger_keys;      // bitset of triecodes that can end a sequence (optional)
+    const uint8_t  *trigger_pair_index;// pair table row for each triecode (optional)
+    const uint8_t  *trigger_pair_rows; // bitsets of triecodes that can precede the last key (optional)
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+    st_storage_t   *storage;           // if set, data and completions are read from here
+    uint32_t       data_address;       // device address of the trie data
+    uint32_t       completions_address;// device address of the completions data
+    uint32_t       payloads_address;   // device address of the payloads
+#endif
 } st_trie_t;
 
+typedef struct
+{
+    uint16_t        offset;         // next entry of the multi-branch to try
+    uint8_t         triecode;       // key the entries are matched against
+    st_cursor_pos_t pos;            // cursor position after that key
+} st_trie_branch_t;
+
 typedef struct
 {
     const st_key_buffer_t * const buffer;           // input buffer this cursor traverses
     const st_trie_t * const       trie;             // trie used for traversing virtual output buffer
     st_cursor_pos_t               pos;              // Contains all position info for the cursor
     st_trie_payload_t             cached_action;
+#if SEQUENCE_TRANSFORM_COMPRESSED_COMPLETIONS
+    uint8_t * const               cached_completion;// decoded completion of cached_action
+#endif
     uint8_t                       cache_valid;
     int                           seq_ref_index;
+    st_trie_branch_t * const      branch_stack;     // multi-branches left to search
+    const int                     branch_stack_size;// TRIE_MULTI_BRANCH_MAX_DEPTH
+    uint8_t                       seq_path[ST_SEQ_CAPTURE_SIZE];   // symbols read by the search so far
+#ifdef ST_TESTER
+    int                           branch_stack_max; // most of branch_stack used
+    bool                          snapshot_disabled;// lets the tester compare against the scalar search
+#endif
 } st_cursor_t;
 
 typedef struct
@@ -90,6 +179,8 @@ typedef struct
     uint16_t            trie_match_index;
     st_cursor_pos_t     seq_match_pos;
     bool                is_chained_match;
+    uint8_t             seq_symbol_count;                   // sequence positions captured in seq_symbols
+    uint8_t             seq_symbols[ST_SEQ_CAPTURE_SIZE];   // symbol matched at each position, most recent first
 } st_trie_match_t;
 
 typedef struct
@@ -98,11 +189,33 @@ typedef struct
     st_trie_payload_t   trie_payload;
 } st_trie_search_result_t;
 
+#ifdef ST_TESTER
+typedef struct
+{
+    long    data_reads;         // bytes of trie data read
+    long    node_visits;        // nodes read by st_find_longest_chain
+    long    branches_followed;  // multi-branch entries searched
+} st_trie_search_stats_t;
+
+// Work done by trie searches, for comparing against the generator's
+// worst case bounds (reset by the caller)
+extern st_trie_search_stats_t st_trie_search_stats;
+#endif
+
 bool st_trie_get_completion(st_cursor_t *cursor, st_trie_search_result_t *res);
+bool st_trie_can_trigger(const st_trie_t *trie, const st_key_buffer_t *buf);
+bool st_trie_can_trigger_keys(const st_trie_t *trie, uint8_t triecode, uint8_t prev_triecode);
 
 uint16_t st_get_trie_data_word(const st_trie_t *trie, int index);
 uint8_t  st_get_trie_data_byte(const st_trie_t *trie, int index);
 uint8_t  st_get_trie_completion_byte(const st_trie_t *trie, int index);
+uint8_t  st_get_trie_payload_byte(const st_trie_t *trie, int index);
+#if SEQUENCE_TRANSFORM_STORAGE_PAGE_SIZE > 0
+uint8_t  st_trie_read_byte(const st_trie_t *trie, int index);
+uint8_t  st_trie_read_completion_byte(const st_trie_t *trie, int index);
+uint8_t  st_trie_read_payload_byte(const st_trie_t *trie, int index);
+int      st_trie_pin_top_level(const st_trie_t *trie);
+#endif
 
 //////////////////////////////////////////////////////////////////
 // Internal
@@ -118,6 +231,7 @@ typedef struct
     st_trie_rule_t * const          result;             // pointer to result to be filled with best match
 } st_trie_search_t;
 
+void st_get_node_info(const st_trie_t *trie, st_trie_node_info_t *node_info, uint16_t *offset);
 void st_get_payload_from_match_index(const st_trie_t *trie, st_trie_payload_t *payload, uint16_t trie_match_index);
 void st_get_payload_from_code(st_trie_payload_t *payload, uint8_t code_byte1, uint8_t code_byte2, uint16_t completion_index);
 st_trie_match_type_t st_find_longest_chain(st_cursor_t *cursor, st_trie_match_t *longest_match, uint16_t offset);
@@ -0,0 +1,95 @@
+// Copyright 2024 Guillaume Stordeur <guillaume.stordeur@gmail.com>
+// Copyright 2024 Matt Skalecki <ikcelaks@gmail.com>
+// Copyright 2024 QKekos <q.kekos.q@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+
+#include "qmk_wrapper.h"
+#include "undo_journal.h"
+
+//////////////////////////////////////////////////////////////////
+// Records the edit of the most recent key, overwriting the oldest
+// entry if the journal is full. Must be called before the edit's
+// backspaces are output, so the `restore_len` chars they delete
+// (and the one before them when the natural backspace is unwanted)
+// are the last ones in the output ring.
+// If the ring doesn't hold that many, older entries may no longer
+// match what is on screen either, so the journal is emptied.
+// returns false if the edit wasn't recorded
+bool st_undo_journal_push(st_undo_journal_t *journal, uint16_t action, int backspaces, int restore_len)
+{
+    if (restore_len > journal->output_size) {
+        journal->head = 0;
+        journal->size = 0;
+        return false;
+    }
+    const int index = journal->head;
+    st_undo_entry_t *entry = &journal->entries[index];
+    entry->action = action;
+    entry->backspaces = backspaces;
+    entry->restore_len = restore_len;
+    uint8_t *text = &journal->text[index * journal->max_restore];
+    for (int i = 0; i < restore_len; ++i) {
+        const int pos = journal->output_head - restore_len + i;
+        text[i] = journal->output[pos < 0 ? pos + journal->max_restore : pos];
+    }
+    journal->head = (index + 1) % journal->capacity;
+    if (journal->size < journal->capacity) {
+        ++journal->size;
+    }
+    return true;
+}
+//////////////////////////////////////////////////////////////////
+// Entries are pushed and popped along with the keys that made them,
+// and the journal is reset with the key buffer, so the most recent
+// one belongs to the most recent key that performed an action.
+// The action check catches any other change made to the buffer
+// behind the journal's back.
+// returns the entry of the most recent key if its `action` matches, 0 otherwise
+const st_undo_entry_t *st_undo_journal_peek(const st_undo_journal_t *journal, uint16_t action, const uint8_t **text)
+{
+    if (journal->size == 0) {
+        return 0;
+    }
+    const int index = (journal->head + journal->capacity - 1) % journal->capacity;
+    const st_undo_entry_t *entry = &journal->entries[index];
+    if (entry->action != action) {
+        return 0;
+    }
+    *text = &journal->text[index * journal->max_restore];
+    return entry;
+}
+//////////////////////////////////////////////////////////////////
+void st_undo_journal_pop(st_undo_journal_t *journal)
+{
+    if (journal->size > 0) {
+        journal->head = (journal->head + journal->capacity - 1) % journal->capacity;
+        --journal->size;
+    }
+}
+//////////////////////////////////////////////////////////////////
+// Forgets all edits and output, when the key buffer is reset
+void st_undo_journal_reset(st_undo_journal_t *journal)
+{
+    journal->head = 0;
+    journal->size = 0;
+    journal->output_head = 0;
+    journal->output_size = 0;
+}
+//////////////////////////////////////////////////////////////////
+// Records a char sent to the host, by an action or a key let through
+void st_undo_journal_output_key(st_undo_journal_t *journal, uint8_t triecode)
+{
+    journal->output[journal->output_head] = triecode;
+    journal->output_head = (journal->output_head + 1) % journal->max_restore;
+    if (journal->output_size < journal->max_restore) {
+        ++journal->output_size;
+    }
+}
+//////////////////////////////////////////////////////////////////
+// Records backspaces sent to the host, including natural ones
+void st_undo_journal_output_backspaces(st_undo_journal_t *journal, int count)
+{
+    count = MIN(count, journal->output_size);
+    journal->output_size -= count;
+    journal->output_head = (journal->output_head + journal->max_restore - count) % journal->max_restore;
+}
@@ -0,0 +1,40 @@
+// Copyright 2024 Guillaume Stordeur <guillaume.stordeur@gmail.com>
+// Copyright 2024 Matt Skalecki <ikcelaks@gmail.com>
+// Copyright 2024 QKekos <q.kekos.q@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+//////////////////////////////////////////////////////////////////
+// Public API
+
+// Edit sent by a key that performed an action, as needed to undo it
+typedef struct
+{
+    uint16_t    action;         // action_taken of the key
+    uint8_t     backspaces;     // backspaces to send on top of the natural one
+    uint8_t     restore_len;    // chars to type back once those are sent
+} st_undo_entry_t;
+
+// Ring of the most recent edits. Entry i restores the chars
+// stored at text[i * max_restore], oldest first.
+// The chars are copied from `output`, a ring of the last max_restore
+// chars the engine output or let through, as they were sent.
+typedef struct
+{
+    st_undo_entry_t * const entries;
+    uint8_t * const         text;
+    uint8_t * const         output;
+    const int               capacity;
+    const int               max_restore;    // max backspaces of a rule + 1
+    int                     head;           // index of the next entry to write
+    int                     size;
+    int                     output_head;    // index of the next output char to write
+    int                     output_size;
+} st_undo_journal_t;
+
+bool                    st_undo_journal_push(st_undo_journal_t *journal, uint16_t action, int backspaces, int restore_len);
+const st_undo_entry_t   *st_undo_journal_peek(const st_undo_journal_t *journal, uint16_t action, const uint8_t **text);
+void                    st_undo_journal_pop(st_undo_journal_t *journal);
+void                    st_undo_journal_reset(st_undo_journal_t *journal);
+void                    st_undo_journal_output_key(st_undo_journal_t *journal, uint8_t triecode);
+void                    st_undo_journal_output_backspaces(st_undo_journal_t *journal, int count);
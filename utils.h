@@ -9,6 +9,9 @@
 
 #define IS_ALPHA_KEYCODE(code) ((code) >= KC_A && (code) <= KC_Z)
 
+// Note: we bit-pack in "reverse" order to optimize loading
+#define PGM_LOADBIT(mem, pos) ((pgm_read_byte(&((mem)[(pos) / 8])) >> ((pos) % 8)) & 0x01)
+
 void        st_multi_tap(uint16_t keycode, int count);
 void        st_send_key(uint16_t keycode);
 int         st_max(int a, int b);